@@ -0,0 +1,108 @@
+#include <Genode/System/Context.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// Scopes fall back to their parent instead of copying its entries, so creating one (and resolving a service through
+// it) must cost the same no matter how many services the application registered. Capture copies every entry and is
+// measured alongside for comparison.
+namespace
+{
+    template <std::size_t N>
+    struct Service
+    {
+        std::size_t Value = N;
+    };
+
+    template <std::size_t... Is>
+    void Register(Gx::Context& context, std::index_sequence<Is...>)
+    {
+        const auto scope = [] (const std::size_t index)
+        {
+            return index % 2 == 0 ? Gx::Context::Scope::Singleton : Gx::Context::Scope::Local;
+        };
+
+        (context.Provide<Service<Is>>([] (const Gx::Context&) { return std::make_unique<Service<Is>>(); }, scope(Is)), ...);
+    }
+
+    // Median of several rounds, in nanoseconds per operation
+    template <typename Operation>
+    double Measure(const Operation& operation)
+    {
+        constexpr std::size_t rounds     = 9;
+        constexpr std::size_t iterations = 2000;
+
+        std::vector<double> samples;
+        for (std::size_t round = 0; round < rounds; round++)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < iterations; i++)
+                operation();
+
+            const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+            samples.push_back(elapsed.count() / iterations);
+        }
+
+        std::nth_element(samples.begin(), samples.begin() + rounds / 2, samples.end());
+        return samples[rounds / 2];
+    }
+
+    struct Result
+    {
+        std::size_t Registrations;
+        double      Scope;
+        double      Capture;
+    };
+
+    template <std::size_t Count>
+    Result Run()
+    {
+        Gx::Context root;
+        Register(root, std::make_index_sequence<Count>{});
+
+        std::size_t sink = 0;
+        const double scope = Measure([&root, &sink]
+        {
+            const auto child = root.CreateScope();
+            sink += child.Require<Service<0>>().Value + child.Require<Service<1>>().Value;
+        });
+
+        const double capture = Measure([&root, &sink]
+        {
+            const auto captured = root.Capture();
+            sink += captured.Require<Service<0>>().Value;
+        });
+
+        // Keeps the measured work observable
+        if (sink == 0)
+            std::printf(" ");
+
+        return {Count, scope, capture};
+    }
+}
+
+int main()
+{
+    const Result results[] = {Run<4>(), Run<16>(), Run<64>(), Run<256>()};
+
+    std::printf("%14s %16s %16s\n", "registrations", "scope (ns)", "capture (ns)");
+    for (const auto& result : results)
+        std::printf("%14zu %16.1f %16.1f\n", result.Registrations, result.Scope, result.Capture);
+
+    // The bound is generous on purpose, a scope that copies its parent grows with the registrations (64x here)
+    const double growth = results[3].Scope / std::max(results[0].Scope, 1.0);
+    if (growth > 8.0)
+    {
+        std::printf("Scope creation grew %.1fx from %zu to %zu registrations\n", growth,
+                    results[0].Registrations, results[3].Registrations);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("Context scopes: checked\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+#include <Genode/Graphics/SpriteBatch.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Culled submissions keep their place in a dynamic batch, so they can come back into view without restructuring it,
+// but their vertices must never reach the prepared batch or the surface.
+namespace
+{
+    const sf::FloatRect ViewBounds({0.f, 0.f}, {100.f, 100.f});
+
+    class RecordingSurface final : public Gx::RenderSurface
+    {
+    public:
+        std::vector<sf::Vertex> Vertices;
+
+        using RenderSurface::Clear;
+        using RenderSurface::Render;
+
+        void Clear(sf::Color) override {}
+        void Clear(sf::Color, sf::StencilValue) override {}
+        void Render(const Gx::Renderable& renderable, const Gx::RenderStates& states) override { renderable.Render(*this, states); }
+        void Render(const sf::VertexBuffer&, const Gx::RenderStates&) override {}
+        void Render(const sf::VertexBuffer&, std::size_t, std::size_t, const Gx::RenderStates&) override {}
+
+        void Render(const sf::Vertex* vertices, const std::size_t vertexCount, sf::PrimitiveType, const Gx::RenderStates&) override
+        {
+            Vertices.insert(Vertices.end(), vertices, vertices + vertexCount);
+        }
+
+        [[nodiscard]] const sf::View& GetDefaultView() const override { return m_view; }
+        [[nodiscard]] const sf::View& GetView() const override { return m_view; }
+        void SetView(const sf::View& view) override { m_view = view; }
+
+        [[nodiscard]] std::optional<sf::FloatRect> GetViewBounds() const override { return ViewBounds; }
+
+    private:
+        sf::View m_view;
+    };
+
+    // Every quad carries its index in its color, so prepared vertices can be traced back to their submission
+    std::size_t GetQuadIndex(const sf::Vertex& vertex)
+    {
+        return vertex.color.r | (vertex.color.g << 8);
+    }
+
+    void SetQuad(std::vector<sf::Vertex>& quad, const std::size_t index, const sf::Vector2f position)
+    {
+        const auto color = sf::Color(static_cast<std::uint8_t>(index & 0xFF), static_cast<std::uint8_t>((index >> 8) & 0xFF), 0);
+        quad[0] = sf::Vertex{position, color, {}};
+        quad[1] = sf::Vertex{position + sf::Vector2f(4.f, 0.f), color, {}};
+        quad[2] = sf::Vertex{position + sf::Vector2f(0.f, 4.f), color, {}};
+        quad[3] = sf::Vertex{position + sf::Vector2f(4.f, 4.f), color, {}};
+    }
+
+    std::vector<std::size_t> CollectQuads(const sf::Vertex* vertices, const std::size_t count)
+    {
+        std::vector<std::size_t> quads;
+        for (std::size_t i = 0; i < count; i++)
+            quads.push_back(GetQuadIndex(vertices[i]));
+
+        std::sort(quads.begin(), quads.end());
+        quads.erase(std::unique(quads.begin(), quads.end()), quads.end());
+
+        return quads;
+    }
+}
+
+int main()
+{
+    std::size_t failures = 0;
+    const auto fail = [&failures] (const char* message, const std::size_t frame)
+    {
+        std::printf("%s (frame %zu)\n", message, frame);
+        failures++;
+    };
+
+    sf::Texture textures[3];
+    for (const auto geometry : {Gx::SpriteBatch::Geometry::Triangles, Gx::SpriteBatch::Geometry::Indexed})
+    {
+        for (const auto mode : {Gx::SpriteBatch::Mode::Deferred, Gx::SpriteBatch::Mode::TextureSort})
+        {
+            auto batch = Gx::SpriteBatch(mode, Gx::SpriteBatch::Usage::Dynamic);
+            batch.SetBatchGeometry(geometry);
+            batch.SetCulling(true);
+            batch.SetViewBounds(ViewBounds);
+
+            std::mt19937 random(7);
+            std::vector<sf::Vector2f>            positions(300);
+            std::vector<std::vector<sf::Vertex>> quads(positions.size(), std::vector<sf::Vertex>(4));
+            for (auto& position : positions)
+                position = {static_cast<float>(random() % 200), static_cast<float>(random() % 200)};
+
+            for (std::size_t frame = 0; frame < 64; frame++)
+            {
+                // Move some quads across the view edge, the others keep their submission
+                for (std::size_t i = 0; i < 16; i++)
+                    positions[random() % positions.size()] = {static_cast<float>(random() % 200), static_cast<float>(random() % 200)};
+
+                std::vector<std::size_t> visible;
+                for (std::size_t i = 0; i < quads.size(); i++)
+                {
+                    SetQuad(quads[i], i, positions[i]);
+                    batch.Batch(quads[i].data(), quads[i].size(), sf::PrimitiveType::TriangleStrip, &textures[i % 3]);
+
+                    if (positions[i].x <= ViewBounds.size.x && positions[i].y <= ViewBounds.size.y)
+                        visible.push_back(i);
+                }
+
+                RecordingSurface surface;
+                static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+
+                const sf::Vertex* prepared = batch.GetPreparedVertices();
+                const std::size_t count    = batch.GetPreparedVertexCount();
+                const std::size_t expected = geometry == Gx::SpriteBatch::Geometry::Indexed ? 4 : 6;
+                if (count != visible.size() * expected)
+                    fail("Prepared vertex count includes culled submissions", frame);
+
+                if (geometry == Gx::SpriteBatch::Geometry::Indexed && batch.GetPreparedIndices().size() != visible.size() * 6)
+                    fail("Prepared index count includes culled submissions", frame);
+
+                if (CollectQuads(prepared, count) != visible)
+                    fail("Prepared vertices do not match the visible submissions", frame);
+
+                if (CollectQuads(surface.Vertices.data(), surface.Vertices.size()) != visible)
+                    fail("Rendered vertices do not match the visible submissions", frame);
+
+                if (batch.GetCulledSubmissionCount() + visible.size() != quads.size())
+                    fail("Culled submission count is off", frame);
+            }
+        }
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%zu sprite batch culling check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("SpriteBatch culling: checked\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+#include <Genode/Graphics/SpriteBatch.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Indexed geometry must describe exactly the triangles that the expanded geometry prepares, in the same order, while
+// storing every submitted vertex only once. 16-bit indices must match the 32-bit ones.
+namespace
+{
+    struct Submission
+    {
+        std::vector<sf::Vertex> Vertices;
+        sf::PrimitiveType       Type;
+        const sf::Texture*      Texture;
+        float                   Layer;
+    };
+
+    std::vector<Submission> CreateSubmissions(const std::size_t count, const sf::Texture* textures, std::mt19937& random)
+    {
+        const sf::PrimitiveType types[] = {
+            sf::PrimitiveType::TriangleStrip, sf::PrimitiveType::TriangleFan, sf::PrimitiveType::Triangles
+        };
+
+        std::vector<Submission> submissions(count);
+        for (auto& submission : submissions)
+        {
+            submission.Type    = types[random() % 3];
+            submission.Texture = &textures[random() % 3];
+            submission.Layer   = static_cast<float>(random() % 4);
+            submission.Vertices.resize(submission.Type == sf::PrimitiveType::Triangles ? 3 * (1 + random() % 3) : 3 + random() % 5);
+
+            for (auto& vertex : submission.Vertices)
+            {
+                vertex.position  = {static_cast<float>(random() % 1000), static_cast<float>(random() % 1000)};
+                vertex.texCoords = {static_cast<float>(random() % 64), static_cast<float>(random() % 64)};
+                vertex.color     = sf::Color(static_cast<std::uint32_t>(random()));
+            }
+        }
+
+        return submissions;
+    }
+
+    // Records what reaches the surface, with indexed draws expanded
+    class RecordingSurface final : public Gx::RenderSurface
+    {
+    public:
+        std::vector<sf::Vertex> Vertices;
+        std::size_t             ShortIndexedDraws = 0;
+
+        using RenderSurface::Clear;
+        using RenderSurface::Render;
+
+        void Clear(sf::Color) override {}
+        void Clear(sf::Color, sf::StencilValue) override {}
+        void Render(const Gx::Renderable& renderable, const Gx::RenderStates& states) override { renderable.Render(*this, states); }
+        void Render(const sf::VertexBuffer&, const Gx::RenderStates&) override {}
+        void Render(const sf::VertexBuffer&, std::size_t, std::size_t, const Gx::RenderStates&) override {}
+
+        void Render(const sf::Vertex* vertices, const std::size_t vertexCount, sf::PrimitiveType, const Gx::RenderStates&) override
+        {
+            Vertices.insert(Vertices.end(), vertices, vertices + vertexCount);
+        }
+
+        void Render(const sf::Vertex* vertices, std::size_t, const std::uint16_t* indices, const std::size_t indexCount,
+                    const Gx::RenderStates&) override
+        {
+            ShortIndexedDraws++;
+            for (std::size_t i = 0; i < indexCount; i++)
+                Vertices.push_back(vertices[indices[i]]);
+        }
+
+        [[nodiscard]] const sf::View& GetDefaultView() const override { return m_view; }
+        [[nodiscard]] const sf::View& GetView() const override { return m_view; }
+        void SetView(const sf::View& view) override { m_view = view; }
+
+    private:
+        sf::View m_view;
+    };
+
+    const sf::Vertex* Prepare(Gx::SpriteBatch& batch, RecordingSurface& surface, const std::vector<Submission>& submissions)
+    {
+        for (const auto& submission : submissions)
+        {
+            batch.Batch(submission.Vertices.data(), submission.Vertices.size(), submission.Type, submission.Texture,
+                        sf::Transform::Identity, submission.Layer);
+        }
+
+        static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+        return batch.GetPreparedVertices();
+    }
+
+    bool IsSame(const sf::Vertex& a, const sf::Vertex& b)
+    {
+        return a.position == b.position && a.color == b.color && a.texCoords == b.texCoords;
+    }
+
+    template <typename Index>
+    bool IsExpansionOf(const sf::Vertex* expected, const sf::Vertex* vertices, const std::size_t vertexCount, const std::vector<Index>& indices)
+    {
+        for (std::size_t i = 0; i < indices.size(); i++)
+        {
+            if (indices[i] >= vertexCount || !IsSame(expected[i], vertices[indices[i]]))
+                return false;
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    std::size_t failures = 0;
+    const auto fail = [&failures] (const char* message)
+    {
+        std::printf("%s\n", message);
+        failures++;
+    };
+
+    sf::Texture textures[3];
+    std::mt19937 random(11);
+
+    for (const auto mode : {Gx::SpriteBatch::Mode::Deferred, Gx::SpriteBatch::Mode::TextureSort, Gx::SpriteBatch::Mode::LayerSort})
+    {
+        for (const std::size_t count : {1, 2, 17, 500, 20000})
+        {
+            const auto submissions = CreateSubmissions(count, textures, random);
+
+            std::size_t submittedVertices = 0;
+            for (const auto& submission : submissions)
+                submittedVertices += submission.Vertices.size();
+
+            auto triangles = RecordingSurface();
+            auto reference = Gx::SpriteBatch(mode, Gx::SpriteBatch::Usage::Stream);
+            const sf::Vertex* expected      = Prepare(reference, triangles, submissions);
+            const std::size_t expectedCount = reference.GetPreparedVertexCount();
+
+            for (const auto format : {Gx::SpriteBatch::IndexFormat::UInt32, Gx::SpriteBatch::IndexFormat::UInt16})
+            {
+                auto indexed = Gx::SpriteBatch(mode, Gx::SpriteBatch::Usage::Stream);
+                indexed.SetBatchGeometry(Gx::SpriteBatch::Geometry::Indexed);
+                indexed.SetIndexFormat(format);
+
+                auto surface = RecordingSurface();
+                const sf::Vertex* vertices    = Prepare(indexed, surface, submissions);
+                const std::size_t vertexCount = indexed.GetPreparedVertexCount();
+                if (vertexCount != submittedVertices)
+                    fail("Indexed geometry does not store every submitted vertex exactly once");
+
+                // Batches too large for 16-bit indices fall back to 32-bit ones
+                const bool shortIndices = format == Gx::SpriteBatch::IndexFormat::UInt16 && submittedVertices <= 65536;
+                if (shortIndices != (indexed.GetPreparedIndexFormat() == Gx::SpriteBatch::IndexFormat::UInt16))
+                    fail("Prepared index format is off");
+
+                if (shortIndices)
+                {
+                    const auto& indices = indexed.GetPreparedShortIndices();
+                    if (!indexed.GetPreparedIndices().empty() || indices.size() != expectedCount)
+                        fail("16-bit index count does not match the expanded vertex count");
+                    else if (!IsExpansionOf(expected, vertices, vertexCount, indices))
+                        fail("16-bit indices do not reproduce the expanded triangles");
+                }
+                else
+                {
+                    const auto& indices = indexed.GetPreparedIndices();
+                    if (!indexed.GetPreparedShortIndices().empty() || indices.size() != expectedCount)
+                        fail("32-bit index count does not match the expanded vertex count");
+                    else if (!IsExpansionOf(expected, vertices, vertexCount, indices))
+                        fail("32-bit indices do not reproduce the expanded triangles");
+                }
+
+                if ((surface.ShortIndexedDraws > 0) != shortIndices)
+                    fail("16-bit indices did not reach the surface");
+
+                bool rendered = surface.Vertices.size() == triangles.Vertices.size();
+                for (std::size_t i = 0; rendered && i < surface.Vertices.size(); i++)
+                    rendered = IsSame(surface.Vertices[i], triangles.Vertices[i]);
+
+                if (!rendered)
+                    fail("Indexed geometry rendered different triangles");
+            }
+        }
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%zu sprite batch geometry check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("SpriteBatch geometry: checked\n");
+    return EXIT_SUCCESS;
+}
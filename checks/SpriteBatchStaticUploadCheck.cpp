@@ -0,0 +1,163 @@
+#include <Genode/Graphics/Sprite.hpp>
+#include <Genode/Graphics/SpriteBatch.hpp>
+
+#include <SFML/Graphics/Texture.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// A static batch keeps its vertices in a vertex buffer, so steady frames must upload nothing and a single sprite
+// that moves must only upload its own vertices. The storage is stubbed, so the uploads are counted headless.
+namespace
+{
+    class RecordingStorage final : public Gx::VertexBufferStorage
+    {
+    public:
+        std::vector<sf::Vertex>                          Vertices;
+        std::vector<std::pair<std::size_t, std::size_t>> Updates;
+
+        [[nodiscard]] std::size_t GetVertexCount() const override
+        {
+            return Vertices.size();
+        }
+
+        bool Create(const std::size_t vertexCount) override
+        {
+            Vertices.assign(vertexCount, sf::Vertex());
+            return true;
+        }
+
+        bool Update(const sf::Vertex* vertices, const std::size_t vertexCount, const std::size_t offset) override
+        {
+            std::copy(vertices, vertices + vertexCount, Vertices.begin() + static_cast<std::ptrdiff_t>(offset));
+            Updates.emplace_back(offset, vertexCount);
+            return true;
+        }
+
+        void Render(Gx::RenderSurface& surface, const std::size_t firstVertex, const std::size_t vertexCount,
+                    const Gx::RenderStates& states) const override
+        {
+            surface.Render(Vertices.data() + firstVertex, vertexCount, sf::PrimitiveType::Triangles, states);
+        }
+
+        [[nodiscard]] std::size_t GetUploadedBytes() const
+        {
+            std::size_t vertexCount = 0;
+            for (const auto& update : Updates)
+                vertexCount += update.second;
+
+            return vertexCount * sizeof(sf::Vertex);
+        }
+    };
+
+    class NullSurface final : public Gx::RenderSurface
+    {
+    public:
+        using RenderSurface::Clear;
+        using RenderSurface::Render;
+
+        void Clear(sf::Color) override {}
+        void Clear(sf::Color, sf::StencilValue) override {}
+        void Render(const Gx::Renderable& renderable, const Gx::RenderStates& states) override { renderable.Render(*this, states); }
+        void Render(const sf::Vertex*, std::size_t, sf::PrimitiveType, const Gx::RenderStates&) override {}
+        void Render(const sf::VertexBuffer&, const Gx::RenderStates&) override {}
+        void Render(const sf::VertexBuffer&, std::size_t, std::size_t, const Gx::RenderStates&) override {}
+
+        [[nodiscard]] const sf::View& GetDefaultView() const override { return m_view; }
+        [[nodiscard]] const sf::View& GetView() const override { return m_view; }
+        void SetView(const sf::View& view) override { m_view = view; }
+
+    private:
+        sf::View m_view;
+    };
+}
+
+int main()
+{
+    std::size_t failures = 0;
+    const auto fail = [&failures] (const char* message)
+    {
+        std::printf("%s\n", message);
+        failures++;
+    };
+
+    // Sprites are quads, each batched as two triangles
+    constexpr std::size_t spriteVertexCount = 6;
+
+    sf::Texture textures[2];
+    for (const auto mode : {Gx::SpriteBatch::Mode::Deferred, Gx::SpriteBatch::Mode::TextureSort, Gx::SpriteBatch::Mode::LayerSort})
+    {
+        auto batch = Gx::SpriteBatch(mode, Gx::SpriteBatch::Usage::Static);
+        auto storage = std::make_unique<RecordingStorage>();
+        auto& uploads = *storage;
+        batch.SetVertexBufferStorage(std::move(storage));
+
+        std::vector<std::unique_ptr<Gx::Sprite>> sprites;
+        for (std::size_t i = 0; i < 64; i++)
+        {
+            auto sprite = std::make_unique<Gx::Sprite>(textures[i % 2], sf::IntRect({0, 0}, {8, 8}));
+            sprite->SetPosition({static_cast<float>(i % 8) * 10.f, static_cast<float>(i / 8) * 10.f});
+            batch.AddChild(*sprite);
+            sprites.push_back(std::move(sprite));
+        }
+
+        NullSurface surface;
+        static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+        if (uploads.GetUploadedBytes() != sprites.size() * spriteVertexCount * sizeof(sf::Vertex))
+            fail("The first render did not upload the whole batch");
+
+        // Nothing changed, the uploaded batch is drawn as is
+        uploads.Updates.clear();
+        static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+        if (uploads.GetUploadedBytes() != 0)
+            fail("Rendering an unchanged static batch uploaded vertices");
+
+        // Submitted again without changes, every run is matched and skipped
+        batch.InvalidateBatch();
+        static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+        if (uploads.GetUploadedBytes() != 0)
+            fail("Re-submitting an unchanged static batch uploaded vertices");
+
+        // Moving a sprite does not change the children, so the batch is invalidated by hand. Only the vertices of the
+        // moved sprite are uploaded again, at the place they are drawn from
+        for (const std::size_t index : {0, 37, 63})
+        {
+            uploads.Updates.clear();
+            sprites[index]->SetPosition(sprites[index]->GetPosition() + sf::Vector2f(3.f, 1.f));
+            batch.InvalidateBatch();
+            static_cast<void>(batch.Render(surface, Gx::RenderStates::Default));
+
+            if (uploads.GetUploadedBytes() != spriteVertexCount * sizeof(sf::Vertex))
+            {
+                fail("Moving one sprite uploaded more than its own vertices");
+                continue;
+            }
+
+            // Corners lie on the edges of the bounds, so they are tested inclusively
+            const auto bounds = sprites[index]->GetGlobalBounds();
+            for (const auto& [offset, count] : uploads.Updates)
+            {
+                for (std::size_t i = offset; i < offset + count; i++)
+                {
+                    const auto position = uploads.Vertices[i].position;
+                    if (position.x < bounds.position.x || position.x > bounds.position.x + bounds.size.x ||
+                        position.y < bounds.position.y || position.y > bounds.position.y + bounds.size.y)
+                        fail("The uploaded range does not hold the moved sprite");
+                }
+            }
+        }
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%zu static upload check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("SpriteBatch static uploads: checked\n");
+    return EXIT_SUCCESS;
+}
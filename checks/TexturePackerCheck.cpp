@@ -0,0 +1,120 @@
+#include <Genode/Graphics/TexturePacker.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+// Packing must be deterministic: the same sizes always produce the same placements, regardless of what the packer
+// packed before, and the layout of a known input must not drift between builds or platforms.
+namespace
+{
+    using Placements = std::vector<Gx::TexturePacker::Placement>;
+
+    bool IsSame(const Placements& a, const Placements& b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        for (std::size_t i = 0; i < a.size(); i++)
+        {
+            if (a[i].Page != b[i].Page || a[i].Position != b[i].Position)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool IsValid(const Gx::TexturePacker& packer, const std::vector<sf::Vector2u>& sizes, const Placements& placements)
+    {
+        const auto pageSize = packer.GetPageSize();
+        const auto padding  = packer.GetPadding();
+
+        for (std::size_t i = 0; i < sizes.size(); i++)
+        {
+            const auto& a = placements[i];
+            if (sizes[i].x == 0 || sizes[i].y == 0)
+                continue;
+
+            if (a.Page >= packer.GetPageCount() || a.Position.x + sizes[i].x > pageSize.x || a.Position.y + sizes[i].y > pageSize.y)
+                return false;
+
+            // Padded rectangles on the same page must not overlap
+            for (std::size_t j = i + 1; j < sizes.size(); j++)
+            {
+                const auto& b = placements[j];
+                if (sizes[j].x == 0 || sizes[j].y == 0 || a.Page != b.Page)
+                    continue;
+
+                if (a.Position.x < b.Position.x + sizes[j].x + padding && b.Position.x < a.Position.x + sizes[i].x + padding &&
+                    a.Position.y < b.Position.y + sizes[j].y + padding && b.Position.y < a.Position.y + sizes[i].y + padding)
+                    return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    std::size_t failures = 0;
+    const auto fail = [&failures] (const char* message)
+    {
+        std::printf("%s\n", message);
+        failures++;
+    };
+
+    // Known layout, guards against changes in the packing order or the placement rule
+    {
+        const std::vector<sf::Vector2u> sizes = {
+            {20, 10}, {30, 30}, {10, 10}, {64, 8}, {20, 10}, {5, 40}, {40, 20}, {0, 3}, {16, 16}, {33, 33}
+        };
+        const Placements expected = {
+            {0, {40, 17}}, {0, {6, 34}}, {0, {37, 39}}, {1, {0, 21}}, {0, {40, 28}},
+            {0, {0, 0}},   {1, {0, 0}},  {0, {0, 0}},   {0, {40, 0}}, {0, {6, 0}}
+        };
+
+        auto packer = Gx::TexturePacker({64, 64}, 1);
+        if (!IsSame(packer.Pack(sizes), expected) || packer.GetPageCount() != 2)
+            fail("Known input produced a different layout");
+    }
+
+    // Random inputs, packed by a fresh packer and again by one that packed something else in between
+    std::mt19937 random(42);
+    std::uniform_int_distribution<unsigned int> distribution(0, 96);
+
+    auto reused = Gx::TexturePacker({256, 256}, 2);
+    for (std::size_t round = 0; round < 64; round++)
+    {
+        auto sizes = std::vector<sf::Vector2u>(1 + round * 4);
+        for (auto& size : sizes)
+            size = {distribution(random), distribution(random)};
+
+        auto packer = Gx::TexturePacker({256, 256}, 2);
+        const auto placements = packer.Pack(sizes);
+        if (!IsValid(packer, sizes, placements))
+            fail("Placements overlap or exceed the page");
+
+        const auto other = std::vector<sf::Vector2u>(round + 1, {distribution(random) + 1, distribution(random) + 1});
+        static_cast<void>(reused.Pack(other));
+
+        if (!IsSame(reused.Pack(sizes), placements) || reused.GetPageCount() != packer.GetPageCount())
+            fail("Packing the same sizes twice produced different placements");
+
+        for (std::size_t page = 0; page < packer.GetPageCount(); page++)
+        {
+            if (reused.GetPageExtent(page) != packer.GetPageExtent(page))
+                fail("Packing the same sizes twice produced different page extents");
+        }
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%zu texture packer check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("TexturePacker: checked\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,151 @@
+#include <Genode/Graphics/VertexPool.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <utility>
+#include <vector>
+
+// Spans are rented and returned in random order, the way particles do every frame. Blocks must keep tiling the pool:
+// live spans never overlap and stay within it. Free neighbors must be coalesced: every gap between live spans can be
+// rented again as a single span without growing the pool, and the whole pool once everything is returned.
+namespace
+{
+    using Range = std::pair<std::size_t, std::size_t>;
+
+    std::vector<Range> GetRanges(const std::vector<Gx::VertexSpan>& spans)
+    {
+        std::vector<Range> ranges;
+        for (const auto& span : spans)
+        {
+            if (!span.empty())
+                ranges.emplace_back(span.offset(), span.size());
+        }
+
+        std::sort(ranges.begin(), ranges.end());
+        return ranges;
+    }
+
+    bool IsTiled(const std::vector<Range>& ranges, const std::size_t poolSize)
+    {
+        std::size_t end = 0;
+        for (const auto& [offset, size] : ranges)
+        {
+            if (offset < end || offset + size > poolSize)
+                return false;
+
+            end = offset + size;
+        }
+
+        return true;
+    }
+
+    std::vector<Range> GetGaps(const std::vector<Range>& ranges, const std::size_t poolSize)
+    {
+        std::vector<Range> gaps;
+        std::size_t end = 0;
+        for (const auto& [offset, size] : ranges)
+        {
+            if (offset > end)
+                gaps.emplace_back(end, offset - end);
+
+            end = offset + size;
+        }
+
+        if (poolSize > end)
+            gaps.emplace_back(end, poolSize - end);
+
+        return gaps;
+    }
+
+    // The largest gap is only rentable in place when it is held by a single free block
+    bool IsCoalesced(Gx::VertexPool& pool, const std::vector<Range>& ranges)
+    {
+        const auto poolSize = pool.GetSize();
+        const auto gaps     = GetGaps(ranges, poolSize);
+        if (gaps.empty())
+            return true;
+
+        const auto largest = std::max_element(gaps.begin(), gaps.end(),
+            [] (const Range& a, const Range& b) { return a.second < b.second; })->second;
+
+        auto probe = pool.Rent(largest);
+        const auto rented = Range(probe.offset(), probe.size());
+        pool.Return(probe);
+
+        return pool.GetSize() == poolSize && std::find(gaps.begin(), gaps.end(), rented) != gaps.end();
+    }
+}
+
+int main()
+{
+    std::size_t failures = 0;
+    const auto fail = [&failures] (const char* message, const std::size_t step)
+    {
+        std::printf("%s (step %zu)\n", message, step);
+        failures++;
+    };
+
+    std::mt19937 random(5);
+    std::uniform_int_distribution<std::size_t> sizes(1, 96);
+
+    Gx::VertexPool pool;
+    std::vector<Gx::VertexSpan> spans;
+
+    constexpr std::size_t steps = 200000;
+    std::chrono::duration<double, std::nano> elapsed{};
+
+    for (std::size_t step = 0; step < steps; step++)
+    {
+        // Keep around a thousand spans alive, with bursts of returns every now and then
+        const bool burst = step % 5000 == 4999;
+        const auto start = std::chrono::steady_clock::now();
+        if (!spans.empty() && (burst || random() % 2000 < spans.size()))
+        {
+            const auto count = burst ? spans.size() / 2 : 1;
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const auto index = random() % spans.size();
+                pool.Return(spans[index]);
+                std::swap(spans[index], spans.back());
+                spans.pop_back();
+            }
+        }
+        else
+        {
+            spans.push_back(pool.Rent(sizes(random)));
+        }
+
+        elapsed += std::chrono::steady_clock::now() - start;
+
+        if (step % 997 == 0)
+        {
+            const auto ranges = GetRanges(spans);
+            if (!IsTiled(ranges, pool.GetSize()))
+                fail("Live spans overlap or exceed the pool", step);
+
+            if (!IsCoalesced(pool, ranges))
+                fail("A gap between live spans is split into several free blocks", step);
+        }
+    }
+
+    for (auto& span : spans)
+        pool.Return(span);
+
+    const auto poolSize = pool.GetSize();
+    auto whole = pool.Rent(poolSize);
+    if (whole.offset() != 0 || pool.GetSize() != poolSize)
+        fail("Returning every span did not coalesce the pool into a single block", steps);
+
+    std::printf("VertexPool: %.1f ns per rent or return, %zu vertices\n", elapsed.count() / steps, poolSize);
+    if (failures > 0)
+    {
+        std::printf("%zu vertex pool check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("VertexPool: checked\n");
+    return EXIT_SUCCESS;
+}
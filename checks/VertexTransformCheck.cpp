@@ -0,0 +1,113 @@
+#include <Genode/Graphics/VertexTransform.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+// Every vertex transform kernel must match sf::Transform::transformPoint bit for bit, including the tails that
+// do not fill a whole register, and must carry colors and texture coordinates over untouched.
+namespace
+{
+    const char* GetKernelName(const Gx::VertexTransform::Kernel kernel)
+    {
+        switch (kernel)
+        {
+            case Gx::VertexTransform::Kernel::SSE2: return "SSE2";
+            case Gx::VertexTransform::Kernel::AVX2: return "AVX2";
+            default:                                return "Scalar";
+        }
+    }
+
+    bool IsSame(const sf::Vertex& a, const sf::Vertex& b)
+    {
+        return std::memcmp(&a, &b, sizeof(sf::Vertex)) == 0;
+    }
+
+    bool Check(const Gx::VertexTransform::Kernel kernel, const sf::Transform& transform, const std::vector<sf::Vertex>& source, const std::size_t offset, const std::size_t count)
+    {
+        // Offsets move the first vertex off the natural alignment of the buffer
+        std::vector<sf::Vertex> output(offset + count);
+        std::vector<sf::Vertex> inplace(source.begin(), source.begin() + static_cast<std::ptrdiff_t>(offset + count));
+
+        Gx::VertexTransform::Transform(transform, source.data() + offset, output.data() + offset, count, kernel);
+        Gx::VertexTransform::Transform(transform, inplace.data() + offset, inplace.data() + offset, count, kernel);
+
+        for (std::size_t i = 0; i < count; i++)
+        {
+            auto expected     = source[offset + i];
+            expected.position = transform.transformPoint(expected.position);
+
+            if (!IsSame(output[offset + i], expected) || !IsSame(inplace[offset + i], expected))
+            {
+                std::printf("%s: vertex %zu of %zu (offset %zu) differs from sf::Transform::transformPoint\n",
+                            GetKernelName(kernel), i, count, offset);
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+int main()
+{
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> distribution(-4096.f, 4096.f);
+
+    std::vector<sf::Vertex> source(1024 + 8);
+    for (auto& vertex : source)
+    {
+        vertex.position  = {distribution(random), distribution(random)};
+        vertex.texCoords = {distribution(random), distribution(random)};
+        vertex.color     = sf::Color(static_cast<std::uint32_t>(random()));
+    }
+
+    std::vector<sf::Transform> transforms(4);
+    transforms[0].translate({12.5f, -7.25f});
+    transforms[1].rotate(sf::degrees(33.f)).scale({1.5f, 0.75f});
+    transforms[2].translate({-300.f, 150.f}).rotate(sf::degrees(-71.f), {20.f, 40.f}).scale({-2.f, 3.f});
+    transforms[3] = sf::Transform(distribution(random), distribution(random), distribution(random),
+                                  distribution(random), distribution(random), distribution(random),
+                                  0.f, 0.f, 1.f);
+
+    // Every count up to a few registers covers each tail length, the larger ones cover the main loops
+    std::vector<std::size_t> counts;
+    for (std::size_t count = 0; count <= 19; count++)
+        counts.push_back(count);
+
+    counts.insert(counts.end(), {31, 33, 63, 64, 65, 257, 1023, 1024});
+
+    std::size_t failures = 0;
+    for (const auto kernel : {Gx::VertexTransform::Kernel::Scalar, Gx::VertexTransform::Kernel::SSE2, Gx::VertexTransform::Kernel::AVX2})
+    {
+        if (!Gx::VertexTransform::IsSupported(kernel))
+        {
+            std::printf("%s: not supported, skipped\n", GetKernelName(kernel));
+            continue;
+        }
+
+        for (const auto& transform : transforms)
+        {
+            for (const auto count : counts)
+            {
+                for (std::size_t offset = 0; offset < 3; offset++)
+                {
+                    if (!Check(kernel, transform, source, offset, count))
+                        failures++;
+                }
+            }
+        }
+
+        std::printf("%s: checked\n", GetKernelName(kernel));
+    }
+
+    if (failures > 0)
+    {
+        std::printf("%zu vertex transform check(s) failed\n", failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
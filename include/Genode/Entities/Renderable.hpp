@@ -7,6 +7,10 @@
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 
+#include <atomic>
+#include <cstdint>
+#include <optional>
+
 namespace Gx
 {
     class Renderable : public sf::Drawable
@@ -19,7 +23,15 @@ namespace Gx
         [[nodiscard]] virtual bool IsVisible() const { return m_visible; }
         virtual void SetVisible(const bool visible) { m_visible = visible; }
 
+        [[nodiscard]] std::uint64_t GetRenderVersion() const { return m_renderVersion; }
+
+        // Bounds of everything Render submits, in the space of the states passed to it; nothing means never culled
+        [[nodiscard]] virtual std::optional<sf::FloatRect> GetRenderBounds() const { return std::nullopt; }
+
     protected:
+        // Stamps are unique across all renderables, call whenever the vertices submitted by Render change
+        void InvalidateRenderVersion() { m_renderVersion = ++s_renderVersion; }
+
         void draw(sf::RenderTarget& target, const sf::RenderStates states) const override
         {
             auto adapter = RenderSurfaceAdaptor(target);
@@ -27,6 +39,9 @@ namespace Gx
         }
 
     private:
+        inline static std::atomic<std::uint64_t> s_renderVersion{0};
+
         bool m_visible = true;
+        std::uint64_t m_renderVersion = ++s_renderVersion;
     };
 }
@@ -4,7 +4,15 @@
 #include <Genode/Graphics/RenderStates.hpp>
 #include <Genode/Graphics/RenderSurface.hpp>
 #include <Genode/Graphics/RenderSurfaceAdaptor.hpp>
+#include <Genode/Graphics/RenderStats.hpp>
+#include <Genode/Graphics/RenderStatsSurface.hpp>
 #include <Genode/Graphics/VertexPool.hpp>
+#include <Genode/Graphics/VertexBufferStorage.hpp>
+#include <Genode/Graphics/VertexBufferAdaptor.hpp>
+#include <Genode/Graphics/VertexTransform.hpp>
+#include <Genode/Graphics/TextureRegion.hpp>
+#include <Genode/Graphics/TexturePacker.hpp>
+#include <Genode/Graphics/TextureAtlas.hpp>
 #include <Genode/Graphics/Transformable.hpp>
 #include <Genode/Graphics/Sprite.hpp>
 #include <Genode/Graphics/Animation.hpp>
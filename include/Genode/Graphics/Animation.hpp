@@ -35,6 +35,9 @@ namespace Gx
         Animation();
         Animation(const sf::Texture& texture, const sf::Time& duration, std::initializer_list<Frame> frames);
 
+        // Frame coordinates are relative to the region, e.g. a sprite sheet packed into a texture atlas
+        Animation(const TextureRegion& region, const sf::Time& duration, std::initializer_list<Frame> frames);
+
         template<typename... Args>
         void AddFrame(const Frame& first, const Args&... args);
         void AddFrame(const Frame& frame);
@@ -13,6 +13,7 @@ namespace Gx
 
         const unsigned int FrameID = 0;
         const sf::Time Delta       = sf::Time::Zero;
+        const float Alpha          = 1.f;
         float Layer                = 0.f;
 
         static const RenderStates Default;
@@ -25,7 +26,7 @@ namespace Gx
         RenderStates(const sf::Shader* shader);           // NOLINT(*-explicit-constructor)
         // ReSharper restore CppNonExplicitConvertingConstructor
 
-        explicit RenderStates(const sf::RenderStates& states, unsigned int frameID = 0, const sf::Time& delta = sf::Time::Zero);
+        explicit RenderStates(const sf::RenderStates& states, unsigned int frameID = 0, const sf::Time& delta = sf::Time::Zero, float alpha = 1.f);
 
         RenderStates& operator=(const RenderStates& states);
 
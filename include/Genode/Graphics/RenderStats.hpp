@@ -0,0 +1,34 @@
+#pragma once
+
+#include <SFML/Graphics/PrimitiveType.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace Gx
+{
+    struct RenderStats
+    {
+        static constexpr std::size_t PrimitiveTypeCount = 6;
+
+        std::size_t DrawCalls            = 0;
+        std::size_t Vertices             = 0;
+        std::size_t IndexedDrawCalls     = 0;
+        std::size_t Indices              = 0;
+        std::size_t VertexBufferDraws    = 0;
+        std::size_t VertexBufferUploads  = 0;
+        std::size_t UploadedVertices     = 0;
+        std::size_t TextureSwitches      = 0;
+        std::size_t BlendModeSwitches    = 0;
+        std::size_t ShaderSwitches       = 0;
+        std::size_t Clears               = 0;
+
+        // Draw calls per primitive type, indexed by sf::PrimitiveType
+        std::array<std::size_t, PrimitiveTypeCount> Primitives = {};
+
+        [[nodiscard]] std::size_t GetDrawCalls(sf::PrimitiveType type) const
+        {
+            return Primitives[static_cast<std::size_t>(type)];
+        }
+    };
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <Genode/Graphics/RenderStats.hpp>
+#include <Genode/Graphics/RenderSurface.hpp>
+
+#include <deque>
+
+namespace Gx
+{
+    // Forwards everything to another surface while counting what reaches it
+    class RenderStatsSurface : public virtual RenderSurface
+    {
+    public:
+        explicit RenderStatsSurface(RenderSurface& surface, std::size_t historySize = 0);
+
+        // Completes the frame being recorded, the previous frame is then available through GetStats
+        void EndFrame();
+
+        [[nodiscard]] const RenderStats& GetStats() const;
+        [[nodiscard]] const RenderStats& GetCurrentStats() const;
+        [[nodiscard]] const std::deque<RenderStats>& GetHistory() const;
+
+        [[nodiscard]] std::size_t GetHistorySize() const;
+        void SetHistorySize(std::size_t historySize);
+
+        [[nodiscard]] RenderSurface& GetSurface() const;
+
+        void Clear() override;
+        void Clear(sf::Color clearColor) override;
+        void Clear(sf::Color clearColor, sf::StencilValue stencilValue) override;
+
+        void Render(const Renderable& renderable, const RenderStates& states = RenderStates::Default) override;
+        void Render(const sf::Vertex*   vertices,
+                    std::size_t         vertexCount,
+                    sf::PrimitiveType   type,
+                    const RenderStates& states = RenderStates::Default
+        ) override;
+
+        void Render(const sf::Vertex*   vertices,
+                    std::size_t         vertexCount,
+                    sf::PrimitiveType   type,
+                    std::uint64_t       version,
+                    const RenderStates& states
+        ) override;
+
+        void Render(const sf::Vertex*    vertices,
+                    std::size_t          vertexCount,
+                    const std::uint32_t* indices,
+                    std::size_t          indexCount,
+                    const RenderStates&  states = RenderStates::Default
+        ) override;
+
+        void Render(const sf::Vertex*    vertices,
+                    std::size_t          vertexCount,
+                    const std::uint16_t* indices,
+                    std::size_t          indexCount,
+                    const RenderStates&  states = RenderStates::Default
+        ) override;
+
+        void Render(const sf::VertexBuffer& vertexBuffer, const RenderStates& states = RenderStates::Default) override;
+        void Render(const sf::VertexBuffer& vertexBuffer,
+                    std::size_t             firstVertex,
+                    std::size_t             vertexCount,
+                    const RenderStates&     states = RenderStates::Default
+        ) override;
+
+        void NotifyUpload(std::size_t vertexCount) override;
+
+        [[nodiscard]] const sf::View& GetDefaultView() const override;
+        [[nodiscard]] const sf::View& GetView() const override;
+        void SetView(const sf::View& view) override;
+        [[nodiscard]] std::optional<sf::FloatRect> GetViewBounds() const override;
+
+    private:
+        void Record(sf::PrimitiveType type, std::size_t vertexCount, const RenderStates& states);
+
+        RenderSurface*          m_surface;
+        RenderStats             m_current;
+        RenderStats             m_last;
+        std::deque<RenderStats> m_history;
+        std::size_t             m_historySize;
+
+        bool                    m_hasState;
+        const sf::Texture*      m_texture;
+        sf::BlendMode           m_blendMode;
+        const sf::Shader*       m_shader;
+    };
+}
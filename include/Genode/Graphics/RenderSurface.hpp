@@ -8,6 +8,10 @@
 #include <SFML/Graphics/VertexBuffer.hpp>
 #include <SFML/Graphics/View.hpp>
 
+#include <cstdint>
+#include <optional>
+#include <vector>
+
 namespace Gx
 {
     class Renderable;
@@ -34,6 +38,39 @@ namespace Gx
                             const RenderStates&     states = RenderStates::Default
         ) = 0;
 
+        // Version stamps the content of the vertices, so surfaces that keep submissions around can skip unchanged ones
+        virtual void Render(const sf::Vertex*   vertices,
+                            std::size_t         vertexCount,
+                            sf::PrimitiveType   type,
+                            std::uint64_t       /* version */,
+                            const RenderStates& states
+        )
+        {
+            Render(vertices, vertexCount, type, states);
+        }
+
+        // SFML render targets have no index support, so unless a surface overrides these, the indexed triangles are
+        // expanded and drawn as plain triangles: indexed geometry then saves memory on the caller side, not bandwidth
+        virtual void Render(const sf::Vertex*      vertices,
+                            std::size_t            /* vertexCount */,
+                            const std::uint32_t*   indices,
+                            std::size_t            indexCount,
+                            const RenderStates&    states = RenderStates::Default
+        )
+        {
+            RenderExpanded(vertices, indices, indexCount, states);
+        }
+
+        virtual void Render(const sf::Vertex*      vertices,
+                            std::size_t            /* vertexCount */,
+                            const std::uint16_t*   indices,
+                            std::size_t            indexCount,
+                            const RenderStates&    states = RenderStates::Default
+        )
+        {
+            RenderExpanded(vertices, indices, indexCount, states);
+        }
+
         virtual void Render(const sf::VertexBuffer& vertexBuffer, const RenderStates& states = RenderStates::Default) = 0;
         virtual void Render(const sf::VertexBuffer& vertexBuffer,
                             std::size_t       firstVertex,
@@ -41,8 +78,38 @@ namespace Gx
                             const RenderStates&     states = RenderStates::Default
         ) = 0;
 
+        // Renderables that write into vertex buffers while rendering report the uploaded vertices here
+        virtual void NotifyUpload(std::size_t /* vertexCount */) {}
+
         [[nodiscard]] virtual const sf::View& GetDefaultView() const = 0;
         [[nodiscard]] virtual const sf::View& GetView() const = 0;
         virtual void SetView(const sf::View& view) = 0;
+
+        // Area covered by the view in the coordinate space of submitted vertices, nothing disables culling
+        [[nodiscard]] virtual std::optional<sf::FloatRect> GetViewBounds() const
+        {
+            return GetView().getInverseTransform().transformRect(sf::FloatRect({-1.f, -1.f}, {2.f, 2.f}));
+        }
+
+        // Bounds are inclusive, so degenerate (e.g. axis-aligned line) bounds touching the view are not culled
+        [[nodiscard]] static bool IsOutsideView(const sf::FloatRect& bounds, const sf::FloatRect& viewBounds)
+        {
+            return bounds.position.x > viewBounds.position.x + viewBounds.size.x ||
+                   bounds.position.y > viewBounds.position.y + viewBounds.size.y ||
+                   bounds.position.x + bounds.size.x < viewBounds.position.x ||
+                   bounds.position.y + bounds.size.y < viewBounds.position.y;
+        }
+
+    private:
+        template <typename Index>
+        void RenderExpanded(const sf::Vertex* vertices, const Index* indices, const std::size_t indexCount, const RenderStates& states)
+        {
+            static thread_local std::vector<sf::Vertex> expanded;
+            expanded.resize(indexCount);
+            for (std::size_t i = 0; i < indexCount; i++)
+                expanded[i] = vertices[indices[i]];
+
+            Render(expanded.data(), expanded.size(), sf::PrimitiveType::Triangles, states);
+        }
     };
 }
@@ -29,6 +29,7 @@
 ////////////////////////////////////////////////////////////
 #include <Genode/Entities/Colorable.hpp>
 #include <Genode/Graphics/BlendMode.hpp>
+#include <Genode/Graphics/TextureRegion.hpp>
 #include <Genode/SceneGraph/RenderableContainer.hpp>
 #include <Genode/SceneGraph/UpdatableContainer.hpp>
 #include <Genode/SceneGraph/InputableContainer.hpp>
@@ -85,6 +86,15 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         Sprite(const sf::Texture&& texture, const sf::IntRect& rectangle) = delete;
 
+        ////////////////////////////////////////////////////////////
+        /// @brief Construct the sprite from a texture region, such as an atlas entry
+        ///
+        /// @param region Source texture and sub-rectangle
+        ///
+        /// @see `SetTexture`
+        ////////////////////////////////////////////////////////////
+        explicit Sprite(const TextureRegion& region);
+
         ////////////////////////////////////////////////////////////
         /// @brief Change the source texture of the sprite
         ///
@@ -100,6 +110,15 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         void SetTexture(const sf::Texture&& texture, bool resetRect = false) = delete;
 
+        ////////////////////////////////////////////////////////////
+        /// @brief Change the source texture and sub-rectangle to a texture region
+        ///
+        /// @param region New texture region, such as an atlas entry
+        ///
+        /// @see `GetTexture`, `GetTexCoords`
+        ////////////////////////////////////////////////////////////
+        void SetTexture(const TextureRegion& region);
+
         ////////////////////////////////////////////////////////////
         /// @brief Set the sub-rectangle of the texture that the sprite will display
         ///
@@ -181,6 +200,15 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         [[nodiscard]] virtual sf::FloatRect GetGlobalBounds() const;
 
+        ////////////////////////////////////////////////////////////
+        /// @brief Get the bounds of the sprite in its parent's space,
+        ///        used to cull it against the view
+        ///
+        /// @return Transformed local bounds, or nothing if the sprite
+        ///         has children that may draw outside of them
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::optional<sf::FloatRect> GetRenderBounds() const override;
+
     protected:
         ////////////////////////////////////////////////////////////
         /// @brief Render the sprite to a render surface
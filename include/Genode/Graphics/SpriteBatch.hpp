@@ -30,6 +30,7 @@
 
 #include <Genode/Entities/Renderable.hpp>
 #include <Genode/Graphics/RenderStates.hpp>
+#include <Genode/Graphics/VertexBufferStorage.hpp>
 #include <Genode/Graphics/VertexPool.hpp>
 #include <Genode/SceneGraph/Node.hpp>
 #include <Genode/SceneGraph/RenderableContainer.hpp>
@@ -39,6 +40,11 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Gx
@@ -94,6 +100,61 @@ namespace Gx
             ///
             ////////////////////////////////////////////////////////////
             Dynamic,
+
+            ////////////////////////////////////////////////////////////
+            /// @brief Uploads the batch into a vertex buffer on flush and
+            ///        keeps drawing it without resubmitting drawables.
+            ///        The batch is submitted again only after
+            ///        InvalidateBatch() is called or the children change,
+            ///        and only the vertex ranges that changed are
+            ///        uploaded again. Indexed geometry is not supported.
+            ///
+            ////////////////////////////////////////////////////////////
+            Static,
+        };
+
+        enum class Geometry
+        {
+            ////////////////////////////////////////////////////////////
+            /// @brief Expands every primitive into independent triangles,
+            ///        each holding its own copy of the three vertices.
+            ///
+            ////////////////////////////////////////////////////////////
+            Triangles,
+
+            ////////////////////////////////////////////////////////////
+            /// @brief Keeps the unique vertices of every primitive and
+            ///        references them through a shared index array, so
+            ///        corners shared by strips and fans (e.g. quads) are
+            ///        transformed and stored only once.
+            ///
+            /// SFML render targets cannot draw indexed geometry, so
+            /// surfaces without native index support (such as the
+            /// RenderSurfaceAdaptor) receive the triangles expanded.
+            /// There, indexed geometry only saves the memory and the
+            /// copies of the prepared batch, not the vertices sent to
+            /// the driver.
+            ///
+            ////////////////////////////////////////////////////////////
+            Indexed,
+        };
+
+        enum class IndexFormat
+        {
+            ////////////////////////////////////////////////////////////
+            /// @brief Prepares 32-bit indices.
+            ///
+            ////////////////////////////////////////////////////////////
+            UInt32,
+
+            ////////////////////////////////////////////////////////////
+            /// @brief Prepares 16-bit indices, halving the size of the
+            ///        index array. Batches that store more vertices
+            ///        than 16-bit indices can reference are prepared
+            ///        with 32-bit indices instead.
+            ///
+            ////////////////////////////////////////////////////////////
+            UInt16,
         };
 
         SpriteBatch() = default;
@@ -127,6 +188,41 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         [[nodiscard]] Usage GetBatchUsage() const;
 
+        ////////////////////////////////////////////////////////////
+        /// @brief Sets the geometry layout used to store the batch
+        ///
+        /// Changing the geometry discards everything batched so far.
+        ///
+        /// @param geometry The new geometry layout to use
+        ///
+        ////////////////////////////////////////////////////////////
+        void SetBatchGeometry(Geometry geometry);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the current geometry layout
+        ///
+        /// @return The current geometry layout
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] Geometry GetBatchGeometry() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Sets the format of the indices prepared when
+        ///        Geometry::Indexed is used
+        ///
+        /// @param format The new index format to use
+        ///
+        ////////////////////////////////////////////////////////////
+        void SetIndexFormat(IndexFormat format);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the requested index format
+        ///
+        /// @return The requested index format
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] IndexFormat GetIndexFormat() const;
+
         ////////////////////////////////////////////////////////////
         /// @brief Gets the vertex pool that holds the vertices to render
         ///
@@ -135,6 +231,139 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         [[nodiscard]] VertexPool& GetVertexPool();
 
+        ////////////////////////////////////////////////////////////
+        /// @brief Sets the storage that receives the uploaded vertices
+        ///        when Usage::Static is used
+        ///
+        /// When no storage is set, a VertexBufferAdaptor is created on
+        /// the first upload.
+        ///
+        /// @param storage The vertex buffer storage to upload to
+        ///
+        ////////////////////////////////////////////////////////////
+        void SetVertexBufferStorage(std::unique_ptr<VertexBufferStorage> storage);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the storage that receives the uploaded vertices
+        ///
+        /// @return Pointer to the storage, or nullptr if nothing has
+        ///         been uploaded yet
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] VertexBufferStorage* GetVertexBufferStorage() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Marks a static batch as outdated, so drawables are
+        ///        submitted again on the next render
+        ///
+        ////////////////////////////////////////////////////////////
+        void InvalidateBatch();
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Checks whether drawables must be submitted to the batch
+        ///        before the next render
+        ///
+        /// @return Always true unless Usage::Static is used and the
+        ///         uploaded batch is still valid
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] bool IsSubmissionRequired() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the vertices prepared by the last render
+        ///
+        /// With Geometry::Triangles every three vertices form a
+        /// triangle. With Geometry::Indexed the vertices are unique
+        /// and referenced by GetPreparedIndices().
+        ///
+        /// @return Pointer to the prepared vertices, or nullptr if
+        ///         nothing has been prepared yet
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] const sf::Vertex* GetPreparedVertices() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the number of vertices prepared by the last render
+        ///
+        /// @return Number of prepared vertices
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::size_t GetPreparedVertexCount() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the triangle indices prepared by the last render
+        ///
+        /// @return The prepared indices, empty unless Geometry::Indexed
+        ///         is used and the indices were prepared as 32-bit
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] const std::vector<std::uint32_t>& GetPreparedIndices() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the 16-bit triangle indices prepared by the
+        ///        last render
+        ///
+        /// @return The prepared indices, empty unless Geometry::Indexed
+        ///         is used and the indices were prepared as 16-bit
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] const std::vector<std::uint16_t>& GetPreparedShortIndices() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the format of the indices prepared by the last
+        ///        render
+        ///
+        /// @return The prepared index format, which may be wider than
+        ///         the requested one
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] IndexFormat GetPreparedIndexFormat() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Sets the area visible through the view, in the
+        ///        space of the batched vertices
+        ///
+        /// When culling is enabled, submissions whose transformed
+        /// vertices fall entirely outside of this area are dropped.
+        /// The bounds are computed from the surface view on every
+        /// render, so this only needs to be called when submitting
+        /// before the batch itself is rendered.
+        ///
+        /// @param bounds The visible area, or nothing to disable
+        ///               culling
+        ///
+        ////////////////////////////////////////////////////////////
+        void SetViewBounds(const std::optional<sf::FloatRect>& bounds);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the area visible through the view, in the
+        ///        space of the batched vertices
+        ///
+        /// @return The visible area, or nothing if culling is
+        ///         disabled. Static batches are never culled since
+        ///         they are kept across view changes.
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::optional<sf::FloatRect> GetViewBounds() const override;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the number of submissions culled by the last
+        ///        flush
+        ///
+        /// @return Number of culled submissions
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::size_t GetCulledSubmissionCount() const;
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the number of submissions batched by the last
+        ///        flush
+        ///
+        /// @return Number of batched submissions
+        ///
+        ////////////////////////////////////////////////////////////
+        [[nodiscard]] std::size_t GetDrawnSubmissionCount() const;
+
         ////////////////////////////////////////////////////////////
         /// @brief Batches an array of vertices
         ///
@@ -147,6 +376,12 @@ namespace Gx
         /// @param layer     The layer at which the drawable will be
         ///                  renderered. This value is used only when
         ///                  BatchMode::LayerSort mode is used.
+        /// @param version   Stamp identifying the content of the
+        ///                  vertices, or 0 if unknown. With Dynamic and
+        ///                  Static usage, a submission that matches the
+        ///                  previous one in pointer, version, transform
+        ///                  and structure is skipped without touching
+        ///                  its vertices.
         ///
         ////////////////////////////////////////////////////////////
         void Batch(const sf::Vertex*    vertices,
@@ -154,7 +389,29 @@ namespace Gx
                    sf::PrimitiveType    type,
                    const sf::Texture*   texture,
                    const sf::Transform& transform = sf::Transform::Identity,
-                   float                layer     = 0.f);
+                   float                layer     = 0.f,
+                   std::uint64_t        version   = 0);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Batches an array of vertices with the given states
+        ///
+        /// The texture, blend mode and shader of the states decide
+        /// which batch the vertices end up in. The transform and
+        /// layer are applied as in the overload above.
+        ///
+        /// @param vertices The array of vertices to be batched
+        /// @param count    How many vertices to batch
+        /// @param type     The primitive formed by the vertices
+        /// @param states   The render states of the vertices
+        /// @param version  Stamp identifying the content of the
+        ///                 vertices, or 0 if unknown
+        ///
+        ////////////////////////////////////////////////////////////
+        void Batch(const sf::Vertex*   vertices,
+                   std::size_t         count,
+                   sf::PrimitiveType   type,
+                   const RenderStates& states,
+                   std::uint64_t       version = 0);
 
         void Batch(const sf::VertexArray& vertices,
                    const sf::Texture*     texture,
@@ -167,7 +424,8 @@ namespace Gx
         /// @brief Renders the batch to the render target
         ///
         /// @param surface The RenderTarget to draw to
-        /// @param states The RenderStates to use. The texture is ignored
+        /// @param states The RenderStates to use. The texture, blend mode
+        ///               and shader are taken from the batched drawables
         ///
         ////////////////////////////////////////////////////////////
         RenderStates Render(RenderSurface& surface, RenderStates states) const override;
@@ -182,6 +440,13 @@ namespace Gx
                     const RenderStates& states
         ) override;
 
+        void Render(const sf::Vertex*   vertices,
+                    std::size_t         vertexCount,
+                    sf::PrimitiveType   type,
+                    std::uint64_t       version,
+                    const RenderStates& states
+        ) override;
+
         void Render(const sf::VertexBuffer& vertexBuffer, const RenderStates& states) override;
         void Render(const sf::VertexBuffer& vertexBuffer,
                     std::size_t             firstVertex,
@@ -201,28 +466,63 @@ namespace Gx
         void ClearBatch();
 
     private:
+        struct RunInfo;
+
         ////////////////////////////////////////////////////////////
-        /// @brief Pushes a triangle into internal storage
+        /// @brief Transforms a submission into its place in the
+        ///        batched vertices
         ///
-        /// @param a         First vertex
-        /// @param b         Second vertex
-        /// @param c         Third vertex
-        /// @param transform Transform to apply before inserting
-        /// @param texture   Texture to apply to triangle
-        /// @param level     The level to use for level sorting
+        /// @param run      The run that describes the submission
+        /// @param vertices The submitted vertices
         ///
         ////////////////////////////////////////////////////////////
-        void PushTriangle(const sf::Vertex&    a,
-                          const sf::Vertex&    b,
-                          const sf::Vertex&    c,
-                          const sf::Transform& transform,
-                          const sf::Texture*   texture,
-                          float                level);
+        void WriteRun(const RunInfo& run, const sf::Vertex* vertices);
 
-        [[nodiscard]] bool IsStructureChanged() const;
+        ////////////////////////////////////////////////////////////
+        /// @brief Discards the batched runs past the given count
+        ///
+        /// @param runCount The number of runs to keep
+        ///
+        ////////////////////////////////////////////////////////////
+        void TruncateRuns(std::size_t runCount);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Checks whether a submission falls entirely outside
+        ///        of the view bounds
+        ///
+        /// @param vertices  The submitted vertices
+        /// @param count     Number of submitted vertices
+        /// @param transform Transform applied to the vertices
+        ///
+        /// @return True if the submission can be dropped
+        ///
+        ////////////////////////////////////////////////////////////
+        bool CullSubmission(const sf::Vertex* vertices, std::size_t count, const sf::Transform& transform);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Gets the index of a render state, registering it
+        ///        if it was not used before
+        ///
+        /// @param states The render states of a submission
+        ///
+        /// @return Index of the texture, blend mode and shader
+        ///         combination of the states
+        ///
+        ////////////////////////////////////////////////////////////
+        std::uint32_t FindState(const sf::RenderStates& states);
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Drops the render states that no batched run
+        ///        refers to anymore
+        ///
+        ////////////////////////////////////////////////////////////
+        void CompactStates();
 
         void RebuildBatch() const;
+        void SortTriangles() const;
         void RewriteVertices() const;
+        void ReserveSpan(std::size_t size) const;
+        void UploadBatch(RenderSurface& surface, bool full) const;
         void Flush();
 
         ////////////////////////////////////////////////////////////
@@ -231,11 +531,62 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         struct TriangleInfo
         {
-            const sf::Texture* texture{}; //!< The triangle's texture
-            float              level{};   //!< The level of the triangle
+            std::uint32_t state{}; //!< Index of the triangle's render state
+            float         level{}; //!< The level of the triangle
 
             TriangleInfo() = default;
-            TriangleInfo(const sf::Texture* theTexture, float theLevel) : texture(theTexture), level(theLevel) {}
+            TriangleInfo(std::uint32_t theState, float theLevel) : state(theState), level(theLevel) {}
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Holds the render state that breaks batches when it
+        ///        changes
+        ///
+        ////////////////////////////////////////////////////////////
+        struct StateInfo
+        {
+            const sf::Texture* texture{};   //!< The texture used to render
+            sf::BlendMode      blendMode{}; //!< The blending mode used to render
+            const sf::Shader*  shader{};    //!< The shader used to render
+
+            StateInfo() = default;
+            StateInfo(const sf::Texture* theTexture, const sf::BlendMode& theBlendMode, const sf::Shader* theShader) :
+            texture(theTexture),
+            blendMode(theBlendMode),
+            shader(theShader)
+            {
+            }
+
+            bool operator==(const StateInfo& other) const
+            {
+                return texture == other.texture && blendMode == other.blendMode && shader == other.shader;
+            }
+        };
+
+        struct StateHash
+        {
+            std::size_t operator()(const StateInfo& state) const;
+        };
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Holds information about a single submission and
+        ///        where it is stored in the batch
+        ///
+        ////////////////////////////////////////////////////////////
+        struct RunInfo
+        {
+            const sf::Vertex*  source{};            //!< The submitted vertices
+            std::uint64_t      version{};           //!< Version stamp of the submitted vertices, 0 if unknown
+            sf::Transform      transform;           //!< Transform applied to the submitted vertices
+            std::uint32_t      state{};             //!< Index of the submission's render state
+            float              level{};             //!< Level of the submission
+            sf::PrimitiveType  type{};              //!< Primitive formed by the submitted vertices
+            std::size_t        vertexCount{};       //!< Number of submitted vertices
+            std::size_t        firstTriangle{};     //!< Index of the first batched triangle
+            std::size_t        triangleCount{};     //!< Number of batched triangles
+            std::size_t        firstVertex{};       //!< Index of the first batched vertex
+            std::size_t        storedVertexCount{}; //!< Number of batched vertices
+            bool               culled{};            //!< If true, the submission was culled and its triangles are left out of the prepared batch
         };
 
         ////////////////////////////////////////////////////////////
@@ -245,11 +596,15 @@ namespace Gx
         struct BatchInfo
         {
             const sf::Texture* texture{};     //!< The texture used to render the batch
-            std::size_t        vertexCount{}; //!< The number of contiguous vertices to render
+            sf::BlendMode      blendMode{};   //!< The blending mode used to render the batch
+            const sf::Shader*  shader{};      //!< The shader used to render the batch
+            std::size_t        vertexCount{}; //!< The number of contiguous vertices (or indices, when indexed) to render
 
             BatchInfo() = default;
-            BatchInfo(const sf::Texture* theTexture, std::size_t theVertexCount) :
-            texture(theTexture),
+            BatchInfo(const StateInfo& state, std::size_t theVertexCount) :
+            texture(state.texture),
+            blendMode(state.blendMode),
+            shader(state.shader),
             vertexCount(theVertexCount)
             {
             }
@@ -259,22 +614,58 @@ namespace Gx
         // Member data
         ////////////////////////////////////////////////////////////
         // Batched Triangles
-        std::vector<TriangleInfo> m_triangles;        //!< Info about batched triangles
-        std::vector<sf::Vertex>   m_unsortedVertices; //!< Vertices currently batched
-        std::vector<TriangleInfo> m_flushedTriangles; //!< Info about triangles locked in at the last flush
-
-        mutable std::vector<BatchInfo>    m_batches; //!< Prepared batch information, ready for rendering
-        mutable std::vector<std::size_t>  m_order;   //!< Triangle permutation of the last rebuild
-        mutable std::optional<VertexSpan> m_span;    //!< Prepared vertices, ready for rendering
+        std::vector<TriangleInfo>  m_triangles;           //!< Info about batched triangles
+        std::vector<sf::Vertex>    m_unsortedVertices;    //!< Vertices currently batched
+        std::vector<std::uint32_t> m_unsortedIndices;     //!< Triangle indices into the batched vertices (indexed geometry only)
+        std::vector<RunInfo>       m_runs;                //!< Submissions the batched data was built from
+        std::vector<std::size_t>   m_dirtyRuns;           //!< Runs rewritten in place since the last flush
+        std::size_t                m_runCursor{};         //!< Number of runs submitted since the last flush
+        bool                       m_structureChanged{};  //!< If true, runs were added or removed since the last flush
+        bool                       m_visibilityChanged{}; //!< If true, runs were culled or came into view since the last flush
+        std::vector<sf::Vertex>    m_transformedVertices; //!< Scratch buffer for strips and fans transformed before splitting
+
+        // Render States
+        std::vector<StateInfo>                                  m_states;      //!< Distinct render states, indexed by triangles and runs
+        std::unordered_map<StateInfo, std::uint32_t, StateHash> m_stateIds;    //!< Index of each distinct render state
+        std::uint32_t                                           m_lastState{}; //!< Index of the most recently used render state
+        std::vector<std::uint32_t>                              m_stateRemap;  //!< Compacted index of each render state
+
+        mutable std::vector<BatchInfo>     m_batches;       //!< Prepared batch information, ready for rendering
+        mutable std::vector<std::size_t>   m_order;         //!< Triangle permutation of the last rebuild
+        mutable std::vector<std::size_t>   m_inverseOrder;  //!< Prepared position of each batched triangle (triangle geometry only)
+        mutable std::vector<std::size_t>   m_vertexOrder;   //!< Unique vertex permutation of the last rebuild (indexed geometry only)
+        mutable std::vector<std::uint32_t> m_indices;       //!< Prepared indices, ready for rendering (indexed geometry only)
+        mutable std::vector<std::uint16_t> m_shortIndices;  //!< Prepared 16-bit indices, ready for rendering (indexed geometry only)
+        mutable std::vector<std::uint32_t> m_remap;         //!< Prepared position of each batched vertex (indexed geometry only)
+        mutable std::optional<VertexSpan>  m_span;          //!< Prepared vertices, ready for rendering
+
+        // Sort Scratch
+        mutable std::vector<std::uint64_t> m_sortKeys;        //!< Packed layer and render state key of each triangle
+        mutable std::vector<std::uint64_t> m_sortKeysBuffer;  //!< Radix sort buffer for the keys
+        mutable std::vector<std::size_t>   m_sortOrderBuffer; //!< Radix sort buffer for the triangle order
+        mutable std::vector<std::uint32_t> m_stateRanks;      //!< Sort rank of each render state in the last rebuild
 
         // Vertex Storage
-        mutable VertexPool m_pool; //!< The pool that holds the prepared vertices
+        mutable VertexPool                                       m_pool;        //!< The pool that holds the prepared vertices
+        mutable std::unique_ptr<VertexBufferStorage>             m_storage;     //!< Uploaded vertices (static usage only)
+        mutable std::vector<std::pair<std::size_t, std::size_t>> m_dirtyRanges; //!< Offset and size of the vertices rewritten since the last upload
 
         // Batch Settings
-        Mode                         m_batchMode{Mode::Deferred};  //!< The current batch strategy
-        Usage                        m_batchUsage{Usage::Dynamic};  //!< The current batch usage
-        std::optional<sf::BlendMode> m_blendMode{};                //!< The blending mode for rendering
-        mutable bool                 m_rebuildRequired{true};      //!< If true, batch must be rebuilt before rendering
+        Mode                         m_batchMode{Mode::Deferred};                //!< The current batch strategy
+        Usage                        m_batchUsage{Usage::Dynamic};               //!< The current batch usage
+        Geometry                     m_geometry{Geometry::Triangles};            //!< The current geometry layout
+        IndexFormat                  m_indexFormat{IndexFormat::UInt32};         //!< The requested index format
+        mutable IndexFormat          m_preparedIndexFormat{IndexFormat::UInt32}; //!< The index format of the last rebuild
+        mutable bool                 m_rebuildRequired{true};                    //!< If true, batch must be rebuilt before rendering
+        mutable bool                 m_uploaded{false};                          //!< If true, the static batch is uploaded and still valid
+        mutable std::uint64_t        m_uploadedVersion{};                        //!< Children version at the time of the last static upload
+
+        // Culling
+        std::optional<sf::FloatRect> m_viewBounds;                    //!< Visible area in batch space, used when culling is enabled
+        std::size_t                  m_culledCount{};                 //!< Submissions culled since the last flush
+        std::size_t                  m_drawnCount{};                  //!< Submissions batched since the last flush
+        std::size_t                  m_lastCulledCount{};             //!< Submissions culled by the last flush
+        std::size_t                  m_lastDrawnCount{};              //!< Submissions batched by the last flush
     };
 
 } // namespace Gx
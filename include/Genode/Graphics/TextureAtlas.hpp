@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Genode/Graphics/TexturePacker.hpp>
+#include <Genode/Graphics/TextureRegion.hpp>
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Gx
+{
+    class TextureAtlas
+    {
+    public:
+        explicit TextureAtlas(const sf::Vector2u& pageSize = {2048, 2048}, unsigned int padding = 1);
+
+        TextureAtlas(const TextureAtlas&) = delete;
+        TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+        // Images are copied and staged until the next Build
+        void Add(const std::string& id, const sf::Image& image);
+
+        // Packs every staged image into new pages, regions from previous builds stay valid
+        void Build();
+        void Clear();
+
+        [[nodiscard]] bool Contains(const std::string& id) const;
+        [[nodiscard]] const TextureRegion* Find(const std::string& id) const;
+        [[nodiscard]] const TextureRegion& GetRegion(const std::string& id) const;
+
+        [[nodiscard]] std::size_t GetPageCount() const;
+        [[nodiscard]] const sf::Texture& GetPage(std::size_t index) const;
+        [[nodiscard]] float GetOccupancy() const;
+        [[nodiscard]] const sf::Vector2u& GetPageSize() const;
+        [[nodiscard]] unsigned int GetPadding() const;
+
+        [[nodiscard]] bool IsSmooth() const;
+        void SetSmooth(bool smooth);
+
+    private:
+        struct StagedImage
+        {
+            std::string Id;
+            sf::Image   Image;
+        };
+
+        sf::Vector2u                                   m_pageSize;
+        unsigned int                                   m_padding;
+        bool                                           m_smooth;
+        std::vector<StagedImage>                       m_staged;
+        std::vector<std::unique_ptr<sf::Texture>>      m_pages;
+        std::unordered_map<std::string, TextureRegion> m_regions;
+        std::size_t                                    m_usedArea;
+    };
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace Gx
+{
+    class TexturePacker
+    {
+    public:
+        struct Placement
+        {
+            std::size_t  Page     = 0;
+            sf::Vector2u Position = sf::Vector2u();
+        };
+
+        explicit TexturePacker(const sf::Vector2u& pageSize, unsigned int padding = 1);
+
+        [[nodiscard]] const sf::Vector2u& GetPageSize() const;
+        [[nodiscard]] unsigned int GetPadding() const;
+        [[nodiscard]] std::size_t GetPageCount() const;
+        [[nodiscard]] sf::Vector2u GetPageExtent(std::size_t page) const;
+        [[nodiscard]] float GetOccupancy() const;
+
+        // Placements are returned in input order, packing is deterministic for identical input
+        std::vector<Placement> Pack(const std::vector<sf::Vector2u>& sizes);
+
+    private:
+        struct SkylineNode
+        {
+            unsigned int X;
+            unsigned int Y;
+            unsigned int Width;
+        };
+
+        struct Page
+        {
+            std::vector<SkylineNode> Skyline;
+            sf::Vector2u             Extent;
+        };
+
+        bool Insert(Page& page, const sf::Vector2u& size, sf::Vector2u& position) const;
+
+        sf::Vector2u      m_pageSize;
+        unsigned int      m_padding;
+        std::vector<Page> m_pages;
+        std::size_t       m_usedArea;
+    };
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+namespace Gx
+{
+    struct TextureRegion
+    {
+        const sf::Texture* Texture   = nullptr;
+        sf::IntRect        TexCoords = sf::IntRect();
+
+        // Translate a rectangle relative to the original image into the region texture space
+        [[nodiscard]] sf::IntRect Map(const sf::IntRect& rectangle) const
+        {
+            return sf::IntRect(TexCoords.position + rectangle.position, rectangle.size);
+        }
+    };
+}
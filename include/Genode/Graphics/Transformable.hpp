@@ -314,6 +314,15 @@ namespace Gx
         ////////////////////////////////////////////////////////////
         [[nodiscard]] const sf::Transform& GetInverseTransform() const;
 
+    protected:
+        ////////////////////////////////////////////////////////////
+        /// @brief Called after the position, rotation, scale or origin changed
+        ///
+        /// Derived classes that cache transforms depending on this
+        /// object can override this to invalidate them.
+        ////////////////////////////////////////////////////////////
+        virtual void OnTransformChanged();
+
     private:
         ////////////////////////////////////////////////////////////
         // Member data
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Genode/Graphics/VertexBufferStorage.hpp>
+
+#include <SFML/Graphics/VertexBuffer.hpp>
+
+namespace Gx
+{
+    class VertexBufferAdaptor : public VertexBufferStorage
+    {
+    public:
+        explicit VertexBufferAdaptor(sf::PrimitiveType primitiveType = sf::PrimitiveType::Triangles,
+                                     sf::VertexBuffer::Usage usage   = sf::VertexBuffer::Usage::Static);
+
+        [[nodiscard]] std::size_t GetVertexCount() const override;
+
+        bool Create(std::size_t vertexCount) override;
+        bool Update(const sf::Vertex* vertices, std::size_t vertexCount, std::size_t offset) override;
+
+        void Render(RenderSurface&      surface,
+                    std::size_t         firstVertex,
+                    std::size_t         vertexCount,
+                    const RenderStates& states
+        ) const override;
+
+        [[nodiscard]] const sf::VertexBuffer& GetVertexBuffer() const;
+
+    private:
+        sf::VertexBuffer m_buffer;
+    };
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Genode/Graphics/RenderStates.hpp>
+#include <Genode/Graphics/RenderSurface.hpp>
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+
+namespace Gx
+{
+    class VertexBufferStorage
+    {
+    public:
+        virtual ~VertexBufferStorage() = default;
+
+        [[nodiscard]] virtual std::size_t GetVertexCount() const = 0;
+
+        virtual bool Create(std::size_t vertexCount) = 0;
+        virtual bool Update(const sf::Vertex* vertices, std::size_t vertexCount, std::size_t offset) = 0;
+
+        virtual void Render(RenderSurface&      surface,
+                            std::size_t         firstVertex,
+                            std::size_t         vertexCount,
+                            const RenderStates& states
+        ) const = 0;
+    };
+}
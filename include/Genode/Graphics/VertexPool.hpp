@@ -5,6 +5,8 @@
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
 
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <optional>
 #include <iterator>
@@ -69,9 +71,10 @@ namespace Gx
     private:
         friend class VertexPool;
 
-        VertexSpan(VertexPool& pool, size_type offset, size_type size, bool scoped = false);
+        VertexSpan(VertexPool& pool, size_type block, size_type offset, size_type size, bool scoped = false);
 
         VertexPool* m_pool = nullptr;
+        size_type   m_block  = {};
         size_type   m_offset = {};
         size_type   m_size   = {};
         bool        m_scoped = false;
@@ -108,20 +111,40 @@ namespace Gx
     private:
         friend class VertexSpan;
 
-        struct Segment
-        {
-            std::size_t m_offset = {};
-            std::size_t m_size   = {};
-            bool m_inUse         = {};
+        static constexpr std::size_t InvalidBlock   = static_cast<std::size_t>(-1);
+        static constexpr std::size_t SizeClassCount = 64;
 
-            Segment(std::size_t offset, std::size_t size, bool inUse = false);
+        // Blocks tile the pool in offset order; free blocks are also linked into the list of their size class
+        struct Block
+        {
+            std::size_t m_offset   = {};
+            std::size_t m_size     = {};
+            std::size_t m_prev     = InvalidBlock;
+            std::size_t m_next     = InvalidBlock;
+            std::size_t m_prevFree = InvalidBlock;
+            std::size_t m_nextFree = InvalidBlock;
+            bool m_inUse           = {};
         };
 
-        [[nodiscard]] std::optional<std::size_t> Scan(std::size_t size) const;
-        void Defragment();
+        [[nodiscard]] std::size_t FindFree(std::size_t size) const;
+        std::size_t Grow(std::size_t size);
+        void Split(std::size_t block, std::size_t size);
+        std::size_t Merge(std::size_t block, std::size_t next);
+
+        std::size_t CreateBlock(std::size_t offset, std::size_t size, std::size_t prev, std::size_t next);
+        void ReleaseBlock(std::size_t block);
+        void LinkFree(std::size_t block);
+        void UnlinkFree(std::size_t block);
+        void ResetBlocks(std::size_t size);
 
         sf::PrimitiveType m_primitive      = sf::PrimitiveType::Triangles;
         std::vector<sf::Vertex> m_vertices = {};
-        std::vector<Segment> m_segments    = {};
+        std::vector<Block> m_blocks        = {};
+        std::vector<std::size_t> m_unused  = {};
+        std::size_t m_lastBlock            = InvalidBlock;
+
+        // Heads are only valid for the classes set in the mask
+        std::array<std::size_t, SizeClassCount> m_freeLists = {};
+        std::uint64_t m_freeClasses                         = {};
     };
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+
+namespace Gx
+{
+    class VertexTransform
+    {
+    public:
+        enum class Kernel
+        {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        [[nodiscard]] static Kernel GetKernel();
+        [[nodiscard]] static bool IsSupported(Kernel kernel);
+
+        // Input and output may point to the same vertices, but must not partially overlap
+        static void Transform(const sf::Transform& transform, const sf::Vertex* input, sf::Vertex* output, std::size_t count);
+        static void Transform(const sf::Transform& transform, const sf::Vertex* input, sf::Vertex* output, std::size_t count, Kernel kernel);
+    };
+}
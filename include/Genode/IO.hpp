@@ -16,5 +16,6 @@
 #include <Genode/IO/ResourceManager.hpp>
 #include <Genode/IO/FontManager.hpp>
 #include <Genode/IO/Loaders/FontLoader.hpp>
+#include <Genode/IO/Loaders/ImageLoader.hpp>
 #include <Genode/IO/Loaders/SoundBufferLoader.hpp>
 #include <Genode/IO/Loaders/TextureLoader.hpp>
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <Genode/IO/ResourceLoader.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+namespace Gx
+{
+    class ImageLoader final : public ResourceLoader<sf::Image>
+    {
+    public:
+        ImageLoader() = default;
+
+        [[nodiscard]] ResourcePtr<sf::Image> LoadFromFile(const std::filesystem::path& fileName, const ResourceContext& ctx) const override;
+        [[nodiscard]] ResourcePtr<sf::Image> LoadFromMemory(void* data, std::size_t size, const ResourceContext& ctx) const override;
+        [[nodiscard]] ResourcePtr<sf::Image> LoadFromStream(sf::InputStream& stream, const ResourceContext& ctx) const override;
+    };
+}
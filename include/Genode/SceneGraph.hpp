@@ -1,6 +1,8 @@
 #pragma once
 
 #include <Genode/SceneGraph/Node.hpp>
+#include <Genode/SceneGraph/NodeRange.hpp>
+#include <Genode/SceneGraph/NodeQuery.hpp>
 #include <Genode/SceneGraph/RenderableContainer.hpp>
 #include <Genode/SceneGraph/RenderBatchContainer.hpp>
 #include <Genode/SceneGraph/UpdatableContainer.hpp>
@@ -8,3 +10,4 @@
 #include <Genode/SceneGraph/TaskContainer.hpp>
 #include <Genode/SceneGraph/Scene.hpp>
 #include <Genode/SceneGraph/SceneDirector.hpp>
+#include <Genode/SceneGraph/SceneStaging.hpp>
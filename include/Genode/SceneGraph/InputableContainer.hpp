@@ -16,7 +16,7 @@ namespace Gx
 
         InputableContainer& operator=(const InputableContainer&) = default;
 
-        std::vector<Inputable*> GetInputableChildren() const;
+        NodeRange<Inputable> GetInputableChildren() const;
 
         bool Input(const sf::Event& ev) override;
 
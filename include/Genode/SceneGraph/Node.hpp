@@ -1,21 +1,42 @@
 #pragma once
 
 #include <Genode/Graphics/Transformable.hpp>
+#include <Genode/SceneGraph/NodeRange.hpp>
 
 #include <string>
 #include <vector>
 #include <memory>
 #include <unordered_set>
+#include <unordered_map>
 #include <cstdint>
+#include <utility>
 
 namespace Gx
 {
+    class Renderable;
+    class Updatable;
+    class Inputable;
+    class Presentable;
+    class Control;
+    class UpdatableContainer;
+
     class Node : public Transformable
     {
     public:
+        enum class Capability : std::uint8_t
+        {
+            None               = 0,
+            Renderable         = 1 << 0,
+            Updatable          = 1 << 1,
+            Inputable          = 1 << 2,
+            Presentable        = 1 << 3,
+            Control            = 1 << 4,
+            UpdatableContainer = 1 << 5
+        };
+
         Node(const Node& other);
         Node(Node&&) noexcept = default;
-        ~Node() override = default;
+        ~Node() override;
 
         Node& operator=(const Node& other);
 
@@ -31,11 +52,23 @@ namespace Gx
 
         [[nodiscard]] std::uint64_t GetVersion() const;
         [[nodiscard]] Node* GetParent() const;
-        [[nodiscard]] std::vector<Node*> GetChildren() const;
+        [[nodiscard]] NodeRange<Node> GetChildren() const;
         [[nodiscard]] std::vector<Node*> GetChildrenByTag(const std::string& tag) const;
+
+        // The first child named exactly as given, otherwise the first child that matches it as a pattern (see Match)
         [[nodiscard]] Node* GetChildByName(const std::string& name) const;
         [[nodiscard]] Node* GetChildByTag(const std::string& tag) const;
         [[nodiscard]] std::size_t GetChildrenCount() const;
+        [[nodiscard]] bool IsIterating() const;
+        [[nodiscard]] const sf::Transform& GetWorldTransform() const;
+
+        [[nodiscard]] bool HasCapability(Capability capability) const;
+        [[nodiscard]] Renderable* AsRenderable() const;
+        [[nodiscard]] Updatable* AsUpdatable() const;
+        [[nodiscard]] Inputable* AsInputable() const;
+        [[nodiscard]] Presentable* AsPresentable() const;
+        [[nodiscard]] Control* AsControl() const;
+        [[nodiscard]] UpdatableContainer* AsUpdatableContainer() const;
 
         void AddChild(Node& child);
         void RemoveChild(Node& child);
@@ -66,7 +99,15 @@ namespace Gx
 
         void SetVersion(std::uint64_t version);
 
+        void OnTransformChanged() override;
+
+        // Called when the cached world transform of this node turns stale, e.g. because an ancestor has moved
+        virtual void OnWorldTransformInvalidated();
+
     private:
+        template<typename T>
+        friend class NodeRange;
+
         enum class State
         {
             Unintialized,
@@ -74,13 +115,69 @@ namespace Gx
             Finalized
         };
 
+        // Lookup index from name and tag to children, each bucket is kept in child order
+        struct ChildIndex
+        {
+            std::unordered_map<std::string, std::vector<Node*>> Names;
+            std::unordered_map<std::string, std::vector<Node*>> Tags;
+        };
+
+        constexpr static std::size_t INDEX_THRESHOLD = 16;
+
+        enum class Mutation
+        {
+            Add,
+            Remove,
+            Clear,
+            Detach
+        };
+
+        // Interface pointers of the node itself, resolved once the node is fully constructed (at the latest when it
+        // is attached to a parent). Copies and moves start unresolved since the pointers belong to the source object.
+        struct Interfaces
+        {
+            Interfaces() = default;
+            Interfaces(const Interfaces&) {}
+            Interfaces& operator=(const Interfaces&) { return *this; }
+
+            bool                Resolved{false};
+            std::uint8_t        Mask{0};
+            Renderable*         AsRenderable{nullptr};
+            Updatable*          AsUpdatable{nullptr};
+            Inputable*          AsInputable{nullptr};
+            Presentable*        AsPresentable{nullptr};
+            Control*            AsControl{nullptr};
+            UpdatableContainer* AsUpdatableContainer{nullptr};
+        };
+
+        void BeginIteration() const;
+        void EndIteration() const;
+        void DropDeferred(Node& child) const;
+
+        void InvalidateWorldTransform();
+
+        Node* Prepare(Node* child) const;
+        ChildIndex* GetIndex() const;
+        void IndexChild(Node& child, bool name, bool tag) const;
+        void UnindexChild(Node& child, bool name, bool tag) const;
+        const Interfaces& GetInterfaces() const;
+
         Node* m_parent{nullptr};
         State m_state{State::Unintialized};
         std::string m_name{};
         std::string m_tag{};
         std::uint64_t m_version{0};
         std::vector<Node*> m_children{};
+        std::uint64_t m_order{0};
+        std::uint64_t m_nextOrder{0};
+        mutable std::unique_ptr<ChildIndex> m_index{};
         mutable std::unordered_set<Node*> m_pending{};
+        mutable std::size_t m_iterations{0};
+        mutable std::vector<std::pair<Mutation, Node*>> m_deferred{};
+        mutable std::vector<const Node*> m_deferrers{};
+        mutable Interfaces m_interfaces{};
+        mutable sf::Transform m_worldTransform{};
+        mutable bool m_worldTransformNeedUpdate{true};
     };
 }
 
@@ -2,6 +2,20 @@
 
 namespace Gx
 {
+    template<typename T>
+    NodeRange<T>::NodeRange(const Node& owner, const std::vector<T*>& items) :
+        m_owner(&owner),
+        m_items(&items)
+    {
+        m_owner->BeginIteration();
+    }
+
+    template<typename T>
+    NodeRange<T>::~NodeRange()
+    {
+        m_owner->EndIteration();
+    }
+
     template<typename T>
     T* Node::GetParent() const
     {
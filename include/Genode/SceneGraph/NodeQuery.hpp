@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Gx
+{
+    class Node;
+
+    // Glob pattern compiled once and matched without allocating. '*' matches any run of characters and '?' matches
+    // a single character, neither of them crosses a '/'. Patterns with '/' can be evaluated as hierarchical paths
+    // against the scene graph, e.g. "hud/*/icon" finds every "icon" grandchild below any child of "hud".
+    class NodeQuery
+    {
+    public:
+        NodeQuery() = default;
+        explicit NodeQuery(const std::string& pattern);
+
+        [[nodiscard]] static bool Match(std::string_view id, std::string_view pattern);
+        [[nodiscard]] static bool Match(const Node& node, std::string_view pattern);
+
+        [[nodiscard]] const std::string& GetPattern() const;
+        [[nodiscard]] std::size_t GetDepth() const;
+
+        [[nodiscard]] bool Match(std::string_view id) const;
+        [[nodiscard]] bool Match(const Node& node) const;
+
+        [[nodiscard]] std::vector<Node*> Find(const Node& root) const;
+        [[nodiscard]] Node* FindFirst(const Node& root) const;
+        void Find(const Node& root, std::vector<Node*>& results) const;
+
+    private:
+        struct Segment
+        {
+            std::size_t Offset{0};
+            std::size_t Length{0};
+            bool Literal{true};
+        };
+
+        [[nodiscard]] static bool MatchSegment(std::string_view text, std::string_view pattern);
+        [[nodiscard]] static bool MatchPath(std::string_view id, std::string_view pattern);
+
+        template<typename Matcher>
+        [[nodiscard]] static bool MatchNode(const Node& node, std::string_view pattern, const Matcher& matcher);
+
+        [[nodiscard]] std::string_view GetSegment(const Segment& segment) const;
+        [[nodiscard]] bool MatchSegment(std::string_view text, const Segment& segment) const;
+        Node* Find(const Node& node, std::size_t depth, std::vector<Node*>* results) const;
+
+        std::string m_pattern{};
+        std::vector<Segment> m_segments{};
+    };
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace Gx
+{
+    class Node;
+
+    // Non-owning view over the children of a node. While any range of a node is alive, children added to or
+    // removed from that node are deferred until the last range ends, so iterating never invalidates the view.
+    template<typename T>
+    class NodeRange
+    {
+    public:
+        using value_type     = T*;
+        using size_type      = std::size_t;
+        using const_iterator = typename std::vector<T*>::const_iterator;
+        using iterator       = const_iterator;
+
+        NodeRange(const Node& owner, const std::vector<T*>& items);
+        ~NodeRange();
+
+        NodeRange(const NodeRange&) = delete;
+        NodeRange& operator=(const NodeRange&) = delete;
+
+        [[nodiscard]] const_iterator begin() const noexcept { return m_items->begin(); }
+        [[nodiscard]] const_iterator end() const noexcept { return m_items->end(); }
+        [[nodiscard]] size_type size() const noexcept { return m_items->size(); }
+        [[nodiscard]] bool empty() const noexcept { return m_items->empty(); }
+        [[nodiscard]] T* operator[](size_type index) const { return (*m_items)[index]; }
+
+    private:
+        const Node*            m_owner;
+        const std::vector<T*>* m_items;
+    };
+}
@@ -18,14 +18,20 @@ namespace Gx
         void SetBatchUsage(SpriteBatch::Usage batchUsage) const;
         [[nodiscard]] SpriteBatch::Usage GetBatchUsage() const;
 
+        void SetBatchGeometry(SpriteBatch::Geometry geometry) const;
+        [[nodiscard]] SpriteBatch::Geometry GetBatchGeometry() const;
+
         [[nodiscard]] VertexPool& GetVertexPool() const;
 
+        void InvalidateBatch() const;
+
     protected:
         void Update(const sf::Time& delta) override;
         RenderStates Render(RenderSurface& surface, RenderStates states) const override;
 
     private:
         // Batcher is kept separate so it doesn't interfere with SceneGraph hierarchy
-        mutable SpriteBatch m_batcher{SpriteBatch::Mode::LayerSort};
+        mutable SpriteBatch   m_batcher{SpriteBatch::Mode::LayerSort};
+        mutable std::uint64_t m_batchVersion{};
     };
 }
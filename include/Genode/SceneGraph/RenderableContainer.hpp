@@ -7,6 +7,15 @@ namespace Gx
 {
     class RenderableContainer : public virtual Node, public virtual Renderable
     {
+    public:
+        // Children with render bounds outside of the surface view are skipped
+        void SetCulling(bool culling);
+        [[nodiscard]] bool IsCulling() const;
+
+        // Number of children culled and drawn by the last render
+        [[nodiscard]] std::size_t GetCulledCount() const;
+        [[nodiscard]] std::size_t GetDrawnCount() const;
+
     protected:
         RenderableContainer() = default;
         RenderableContainer(const RenderableContainer&) = default;
@@ -14,12 +23,20 @@ namespace Gx
 
         RenderableContainer& operator=(const RenderableContainer&) = default;
 
-        std::vector<Renderable*> GetRenderableChildren() const;
+        NodeRange<Renderable> GetRenderableChildren() const;
 
         RenderStates Render(RenderSurface& surface, RenderStates states) const override;
+        RenderStates RenderChildren(RenderSurface& surface, RenderStates states, const std::optional<sf::FloatRect>& viewBounds) const;
+
+        void ResetCullingCounters() const;
+        void SetCullingCounters(std::size_t culledCount, std::size_t drawnCount) const;
+        bool Cull(const Renderable& renderable, const RenderStates& states, const std::optional<sf::FloatRect>& viewBounds) const;
 
     private:
         mutable std::uint64_t m_version{0};
         mutable std::vector<Renderable*> m_renderables;
+        bool m_culling{false};
+        mutable std::size_t m_culledCount{0};
+        mutable std::size_t m_drawnCount{0};
     };
 }
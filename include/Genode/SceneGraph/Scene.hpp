@@ -21,6 +21,7 @@ namespace Gx
 {
     class Application;
     class SceneDirector;
+    class SceneStaging;
     class Scene : public virtual Node,
                   public RenderableContainer,
                   public UpdatableContainer,
@@ -65,11 +66,37 @@ namespace Gx
         virtual void OnAppResized(const sf::Vector2u& size);
         virtual bool OnAppClose();
 
+        // Staged with PresentAsync, OnLoad runs on a worker right after construction, before the scene is attached to
+        // the director. Load resources there and report the progress through the staging. OnLoad may only touch the
+        // scene itself, its resources and its context: services are resolved under a lock while stagings are in
+        // flight, but the services themselves must be safe to use from another thread. The director, the application
+        // and other scenes belong to the main thread. OnLoadCompleted is then called on the main thread once per frame
+        // until it returns true, to create main-thread-only objects within the given budget.
+        virtual void OnLoad(SceneStaging& staging);
+        virtual bool OnLoadCompleted(const sf::Time& budget);
+
+        // Called instead of Finalize and Initialize when the director retains the dismissed scene and presents it again
+        virtual void OnSuspend();
+        virtual void OnResume();
+
+        // Bytes kept alive while the scene is suspended, weighed against the retention budget of the director.
+        // Zero by default, scenes that hold large resources should report them.
+        [[nodiscard]] virtual std::size_t GetRetainedMemory() const;
+
         RenderStates Render(RenderSurface& surface, RenderStates states) const override;
         void Update(const sf::Time& delta) override;
         bool Input(const sf::Event& ev) override;
 
     private:
+        // Interfaces of a presentable are resolved once when it is presented
+        struct PresentableEntry
+        {
+            Presentable* Instance{nullptr};
+            Renderable*  AsRenderable{nullptr};
+            Updatable*   AsUpdatable{nullptr};
+            Inputable*   AsInputable{nullptr};
+        };
+
         [[nodiscard]] bool IsVisible() const override { return true; }
         void SetVisible(const bool visible) override {}
 
@@ -81,7 +108,7 @@ namespace Gx
         mutable sf::View m_view{};
 
         SceneDirector*            m_director{nullptr};
-        std::vector<Presentable*> m_presentables;
+        std::vector<PresentableEntry> m_presentables;
 
         std::optional<sf::Event> m_lastInput{};
         std::mutex m_mutex;
@@ -4,11 +4,17 @@
 #include <Genode/System/Context.hpp>
 #include <Genode/System/Module.hpp>
 #include <Genode/IO/Resource.hpp>
+#include <Genode/SceneGraph/SceneStaging.hpp>
 
 #include <SFML/Graphics.hpp>
 
+#include <list>
+#include <optional>
+#include <unordered_set>
 #include <typeindex>
 #include <stack>
+#include <thread>
+#include <vector>
 #include <Genode/IO/ResourceContext.hpp>
 
 namespace Gx
@@ -94,6 +100,7 @@ namespace Gx
     public:
         explicit SceneDirector(Application& app);
         explicit SceneDirector(RenderSurface& surface);
+        ~SceneDirector() override;
 
         template<typename T, typename... Args>
         SceneDirector(RenderSurface& surface, T& scene, Args&&... args);
@@ -145,6 +152,36 @@ namespace Gx
         template<typename T>
         void Present(T&& scene) = delete;
 
+        // Constructs the scene on the calling thread and loads it (Scene::OnLoad) on a worker while the current scene
+        // keeps running, the scene is presented once it is loaded and finalized. A pending staging is cancelled by the
+        // next one. Scenes presented by reference can not be staged since their instance is shared with the caller.
+        template <typename T, typename Ctx, typename... Args>
+        std::enable_if_t<std::is_base_of_v<Scene, T> && std::is_base_of_v<ResourceContext, Ctx>, SceneStagingRequest>
+        PresentAsync(const Ctx& context, Args&&... args);
+
+        template<typename T, typename... Args>
+        std::enable_if_t<
+            std::is_base_of_v<Scene, T> &&
+            (sizeof...(Args) == 0 ||
+                !std::is_base_of_v<ResourceContext, std::decay_t<std::tuple_element_t<0, std::tuple<Args..., void>>>>
+            ),
+        SceneStagingRequest>
+        PresentAsync(Args&&... args);
+
+        // Time given to Scene::OnLoadCompleted per frame
+        [[nodiscard]] const sf::Time& GetStagingBudget() const;
+        void SetStagingBudget(const sf::Time& budget);
+
+        // Up to the given number of dismissed scenes are kept suspended and resumed instead of rebuilt when they are
+        // presented again without arguments. The least recently dismissed one is finalized first, zero disables it.
+        [[nodiscard]] std::size_t GetRetentionCapacity() const;
+        void SetRetentionCapacity(std::size_t capacity);
+
+        // Retained scenes are also finalized, least recently dismissed first, while the memory they report through
+        // Scene::GetRetainedMemory exceeds the given number of bytes. Zero leaves the memory unbounded.
+        [[nodiscard]] std::size_t GetRetentionBudget() const;
+        void SetRetentionBudget(std::size_t bytes);
+
         template <typename T, typename... Args>
         std::enable_if_t<std::is_base_of_v<Scene, T>, bool>
         Dismiss(const ResourceContext& context, Args&&... args);
@@ -198,17 +235,43 @@ namespace Gx
         using SceneDeserializerMap     = std::unordered_map<std::type_index, SceneGenericDeserializer>;
         using ScenePresentationStack   = std::stack<ScenePresentationData>;
 
+        struct SceneStagingData
+        {
+            SceneStagingRequest                  Request;
+            std::thread                          Worker;
+            std::optional<ScenePresentationData> Presentation;
+            SceneInitializer                     Initializer;
+        };
+
         void Stage();
         void Unstage() const;
+        void ProcessStaging();
+
+        ResourcePtr<Scene> Deserialize(std::type_index type, const SceneGenericDeserializer& deserializer, const ResourceContext& context, bool resumable);
+        void Retain(ResourcePtr<Scene> scene);
+        void Discard();
+        void Trim(std::size_t capacity) const;
 
         RenderSurface&          m_surface;
         SceneDeserializerMap    m_deserializers{};
+        std::unordered_set<std::type_index> m_borrowed{};
         ScenePresentationStack  m_stack{};
         ResourcePtr<Scene>      m_currentScene{};
         ResourcePtr<Scene>      m_nextScene{};
         SceneInitializer        m_initializer{};
         mutable Context         m_context{};
         mutable bool            m_staged{false};
+        mutable bool            m_suspended{false};
+        bool                    m_resumed{false};
+
+        // Most recently dismissed first
+        mutable std::list<ResourcePtr<Scene>> m_retained{};
+        std::size_t                           m_retentionCapacity{0};
+        std::size_t                           m_retentionBudget{0};
+
+        // The last entry is the active staging, the others are cancelled and waiting for their worker
+        std::vector<SceneStagingData> m_stagings{};
+        sf::Time                      m_stagingBudget{sf::milliseconds(4)};
     };
 }
 
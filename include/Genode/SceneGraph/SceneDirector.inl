@@ -41,12 +41,13 @@ namespace Gx
     std::enable_if_t<std::is_base_of_v<Scene, T>, void>
     SceneDirector::Register()
     {
+        m_borrowed.erase(typeid(T));
         m_deserializers[typeid(T)] = SceneGenericDeserializer([this] (const ResourceContext&) -> ResourcePtr<Scene>
         {
             auto context = GetContext().CreateScope();
-            auto scene   = context.Instantiate<T>();
+            auto scene   = ResourcePtr<T>(context.Instantiate<T>().release(), [] (T* ptr) { delete ptr; });
 
-            scene->SetContext(context);
+            scene->SetContext(std::move(context));
             return Cast<Scene>(std::move(scene));
         });
     }
@@ -55,6 +56,7 @@ namespace Gx
     std::enable_if_t<std::is_base_of_v<Scene, T>, void>
     SceneDirector::Register(const SceneDeserializer<T>& deserializer)
     {
+        m_borrowed.erase(typeid(T));
         m_deserializers[typeid(T)] = SceneGenericDeserializer([deserializer] (const ResourceContext& ctx)
         {
             return Cast<Scene>(deserializer(ctx));
@@ -65,6 +67,7 @@ namespace Gx
     std::enable_if_t<std::is_base_of_v<Scene, T>, void>
     SceneDirector::Present(T& scene, Args&&... args)
     {
+        m_borrowed.insert(typeid(T));
         m_deserializers[typeid(T)] = SceneGenericDeserializer([&scene] (const ResourceContext&) -> ResourcePtr<Scene>
         {
             return Cast<Scene>(ResourcePtr<T>(&scene, [] (auto) {}));
@@ -83,7 +86,7 @@ namespace Gx
         if (const auto it = m_deserializers.find(typeid(T)); it != m_deserializers.end())
         {
             deserializer = it->second;
-            scene        = deserializer(context);
+            scene        = Deserialize(typeid(T), deserializer, context, sizeof...(Args) == 0);
         }
 
         if (!scene)
@@ -141,6 +144,100 @@ namespace Gx
         Present<T>(ResourceContext::Default, std::forward<Args>(args)...);
     }
 
+    template <typename T, typename Ctx, typename... Args>
+    std::enable_if_t<std::is_base_of_v<Scene, T> && std::is_base_of_v<ResourceContext, Ctx>, SceneStagingRequest>
+    SceneDirector::PresentAsync(const Ctx& context, Args&&... args)
+    {
+        if (m_deserializers.find(typeid(T)) == m_deserializers.end())
+        {
+            if constexpr (std::is_default_constructible_v<T>)
+                Register<T>();
+            else
+                throw ArgumentException(StringHelper::GetTypeName(typeid(T)) + " is not registered");
+        }
+
+        if (m_borrowed.find(typeid(T)) != m_borrowed.end())
+        {
+            throw InvalidOperationException(
+                StringHelper::GetTypeName(typeid(T)) + " is presented by reference and can not be staged"
+            );
+        }
+
+        // The scene and its context scope are created here, the worker only runs Scene::OnLoad
+        auto scene = m_deserializers[typeid(T)](context);
+        if (!scene)
+            throw ArgumentException(StringHelper::GetTypeName(typeid(T)) + " is not registered");
+
+        if (!scene->m_context.has_value())
+            scene->SetContext(GetContext().CreateScope());
+
+        if (!m_stagings.empty())
+            m_stagings.back().Request->Cancel();
+
+        auto& staging   = m_stagings.emplace_back();
+        staging.Request = std::make_shared<SceneStaging>();
+
+        std::function<void(Scene&)> initializer = nullptr;
+        if constexpr(sizeof...(Args) > 0)
+        {
+            if constexpr((std::is_copy_constructible_v<std::decay_t<Args>> && ...))
+            {
+                initializer = [arguments = std::make_tuple(std::forward<Args>(args)...)] (Scene& target)
+                {
+                    std::apply([&target] (const auto&... unpacked) { dynamic_cast<T&>(target).Initialize(unpacked...); }, arguments);
+                };
+
+                staging.Initializer = initializer;
+            }
+            else
+            {
+                staging.Initializer = [arguments = std::make_tuple(std::forward<Args>(args)...)] (Scene& target) mutable
+                {
+                    std::apply([&target] (auto&... unpacked) { dynamic_cast<T&>(target).Initialize(std::move(unpacked)...); }, arguments);
+                };
+            }
+        }
+
+        const auto deserializer = m_deserializers[typeid(T)];
+        if (T::IsTrackable())
+            staging.Presentation.emplace(typeid(T), initializer, context, deserializer);
+
+        // Services resolved by OnLoad may be shared with the main thread, lookups are serialized until the worker is joined
+        Context::BeginConcurrentAccess();
+        staging.Worker = std::thread([request = staging.Request, scene = std::move(scene)] () mutable
+        {
+            try
+            {
+                if (!request->IsCancelled())
+                    scene->OnLoad(*request);
+
+                request->m_scene  = std::move(scene);
+                request->m_status = SceneStaging::Status::Finalizing;
+            }
+            catch (...)
+            {
+                // Hand the scene back so it is released on the main thread as well
+                request->m_scene     = std::move(scene);
+                request->m_exception = std::current_exception();
+                request->m_status    = SceneStaging::Status::Failed;
+            }
+        });
+
+        return staging.Request;
+    }
+
+    template<typename T, typename... Args>
+    std::enable_if_t<
+        std::is_base_of_v<Scene, T> &&
+        (sizeof...(Args) == 0 ||
+            !std::is_base_of_v<ResourceContext, std::decay_t<std::tuple_element_t<0, std::tuple<Args..., void>>>>
+        ),
+    SceneStagingRequest>
+    SceneDirector::PresentAsync(Args&&... args)
+    {
+        return PresentAsync<T>(ResourceContext::Default, std::forward<Args>(args)...);
+    }
+
     template <typename T, typename... Args>
     std::enable_if_t<std::is_base_of_v<Scene, T>, bool>
     SceneDirector::Dismiss(const ResourceContext& context, Args&&... args)
@@ -160,7 +257,7 @@ namespace Gx
         m_stack = std::move(stack);
         const auto& presentation = m_stack.top();
 
-        auto scene    = presentation.Deserializer(context);
+        auto scene    = Deserialize(presentation.Type, presentation.Deserializer, context, sizeof...(Args) == 0);
         m_initializer = presentation.Initializer;
         if constexpr(sizeof...(Args) > 0)
         {
@@ -208,7 +305,7 @@ namespace Gx
             context->Unbind();
         }
 
-        auto scene    = presentation.Deserializer(context ? *context : ResourceContext::Default);
+        auto scene    = Deserialize(presentation.Type, presentation.Deserializer, context ? *context : ResourceContext::Default, sizeof...(Args) == 0);
         m_initializer = presentation.Initializer;
         if constexpr(sizeof...(Args) > 0)
         {
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Genode/IO/Resource.hpp>
+
+#include <atomic>
+#include <exception>
+#include <memory>
+
+namespace Gx
+{
+    class Scene;
+    class SceneDirector;
+    class SceneStaging final
+    {
+    public:
+        enum class Status
+        {
+            Loading,
+            Finalizing,
+            Presented,
+            Failed,
+            Cancelled
+        };
+
+        SceneStaging() = default;
+        SceneStaging(const SceneStaging&) = delete;
+        SceneStaging& operator=(const SceneStaging&) = delete;
+
+        // Rethrows the exception raised by the scene construction or loading once the staging has failed
+        [[nodiscard]] Status GetStatus() const;
+        [[nodiscard]] bool IsDone() const;
+        [[nodiscard]] bool IsCancelled() const;
+
+        [[nodiscard]] float GetProgress() const;
+        void Report(float progress);
+
+        // The worker is not interrupted, the scene is discarded once it is handed back to the director
+        void Cancel();
+
+    private:
+        friend class SceneDirector;
+
+        std::atomic<Status> m_status{Status::Loading};
+        std::atomic<float>  m_progress{0.f};
+        std::atomic<bool>   m_cancelled{false};
+        std::exception_ptr  m_exception{};
+        ResourcePtr<Scene>  m_scene{};
+    };
+
+    using SceneStagingRequest = std::shared_ptr<SceneStaging>;
+}
@@ -3,10 +3,41 @@
 #include <Genode/SceneGraph/Node.hpp>
 #include <Genode/Entities/Updatable.hpp>
 
+#include <utility>
+
 namespace Gx
 {
     class UpdatableContainer : public virtual Node, public virtual Updatable
     {
+    public:
+        // Parallel hands independent children to the shared WorkerPool, Deterministic runs the same plan on the
+        // calling thread in child order (e.g. for tests). Either way, independent children are updated and joined
+        // before the remaining children are updated sequentially.
+        enum class UpdateMode
+        {
+            Sequential,
+            Parallel,
+            Deterministic
+        };
+
+        [[nodiscard]] UpdateMode GetUpdateMode() const;
+        void SetUpdateMode(UpdateMode mode);
+
+        // An independent container may be updated off the main thread. During its update it may only touch its own
+        // subtree: no adding or removing itself, no access to its parent, siblings, scene, context, resources or
+        // rendering, and no Sleep or Wake of itself. Changes of its transform and children are fine.
+        [[nodiscard]] bool IsIndependent() const;
+        void SetIndependent(bool independent);
+
+        // A sleeping container and its subtree are skipped by the parent until woken up
+        [[nodiscard]] bool IsSleeping() const;
+        void Sleep();
+        void Wake();
+
+        // Update only every N-th frame of the parent, the skipped frames are accumulated into the delta
+        [[nodiscard]] unsigned int GetTickInterval() const;
+        void SetTickInterval(unsigned int frames);
+
     protected:
         UpdatableContainer() = default;
         UpdatableContainer(const UpdatableContainer&) = default;
@@ -14,12 +45,27 @@ namespace Gx
 
         UpdatableContainer& operator=(const UpdatableContainer&) = default;
 
-        std::vector<Updatable*> GetUpdatableChildren() const;
+        NodeRange<Updatable> GetUpdatableChildren() const;
 
         void Update(const sf::Time& delta) override;
 
     private:
+        void InvalidateParentSchedule() const;
+        bool Tick(const sf::Time& delta, sf::Time& elapsed);
+
         mutable std::uint64_t m_version{0};
+        mutable std::uint64_t m_scheduleVersion{0};
+        mutable std::uint64_t m_latestScheduleVersion{0};
         mutable std::vector<Updatable*> m_updatables;
+        mutable std::vector<UpdatableContainer*> m_schedules;
+
+        std::vector<std::pair<Updatable*, sf::Time>> m_jobs;
+
+        UpdateMode m_updateMode{UpdateMode::Sequential};
+        bool m_independent{false};
+        bool m_sleeping{false};
+        unsigned int m_tickInterval{1};
+        unsigned int m_tickFrame{0};
+        sf::Time m_tickElapsed{};
     };
 }
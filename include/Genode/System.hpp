@@ -5,3 +5,4 @@
 #include <Genode/System/Module.hpp>
 #include <Genode/System/Context.hpp>
 #include <Genode/System/Application.hpp>
+#include <Genode/System/WorkerPool.hpp>
@@ -5,8 +5,10 @@
 #include <Genode/System/Module.hpp>
 
 #include <SFML/Window.hpp>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <queue>
 #include <type_traits>
 #include <typeindex>
 #include <vector>
@@ -29,6 +31,33 @@ namespace Gx
         [[nodiscard]] const std::string& GetTitle() const;
         [[nodiscard]] unsigned int GetRenderFrequency() const;
 
+        // A non-zero step runs Update with that fixed delta as many times as the elapsed frame time allows (up to
+        // maxSteps per frame, the remainder beyond is dropped) and passes the leftover fraction of a step to
+        // rendering as RenderStates::Alpha for interpolation. A zero step updates once per frame with the frame time.
+        [[nodiscard]] const sf::Time& GetFixedTimestep() const;
+        [[nodiscard]] unsigned int GetMaxUpdateSteps() const;
+        void SetFixedTimestep(const sf::Time& step, unsigned int maxSteps = 5);
+
+        [[nodiscard]] bool IsVerticalSyncEnabled() const;
+        void SetVerticalSyncEnabled(bool enabled);
+
+        // A headless application runs the whole loop without creating a window, draw calls are discarded after the
+        // renderables have submitted them. Must be set before Start.
+        [[nodiscard]] bool IsHeadless() const;
+        void SetHeadless(bool headless);
+
+        // Stops the loop after the given number of frames, zero runs until closed.
+        [[nodiscard]] std::size_t GetFrameLimit() const;
+        void SetFrameLimit(std::size_t frames);
+
+        // A non-zero frame time replaces the measured delta of every frame, e.g. to simulate as fast as possible.
+        [[nodiscard]] const sf::Time& GetFrameTime() const;
+        void SetFrameTime(const sf::Time& frameTime);
+
+        // Queues an event that is processed along with the window events at the start of the next frame.
+        // Mouse positions of queued events are expected in view coordinates.
+        void PushEvent(const sf::Event& ev);
+
         template <typename TModule>
         std::enable_if_t<std::is_base_of_v<Module, TModule>, void>
         Install();
@@ -106,7 +135,6 @@ namespace Gx
     private:
         struct InternalModule
         {
-            std::type_index Type;
             Module*         Instance{nullptr};
             Renderable*     AsRenderable{nullptr};
             Updatable*      AsUpdatable{nullptr};
@@ -119,24 +147,39 @@ namespace Gx
         template <typename TModule>
         TModule* FindModule() const;
 
+        // Dense per-type index into m_slots, assigned on first use
+        template <typename TModule>
+        static std::size_t GetModuleSlot();
+
         void CreateMainWindow();
+        void ProcessEvent(const sf::Event& ev);
         void UpdateCursor(const sf::Event& ev) const;
 
         inline static Application* m_instance = nullptr;
+        inline static std::atomic<std::size_t> m_nextModuleSlot = 0;
 
         mutable std::unique_ptr<sf::RenderWindow> m_window;
         mutable Context m_context;
+        std::queue<sf::Event> m_events;
         std::vector<InternalModule> m_modules;
+        std::vector<Module*> m_slots;
 
         sf::State m_state;
         sf::VideoMode m_mode;
         sf::View m_view;
+        sf::View m_headlessView;
         sf::ContextSettings m_settings;
         Cursor* m_cursor;
 
         const std::string m_title;
         unsigned int m_frameID;
         unsigned int m_renderFreq;
+        unsigned int m_maxUpdateSteps;
+        sf::Time m_fixedTimestep;
+        sf::Time m_frameTime;
+        std::size_t m_frameLimit;
+        bool m_verticalSync;
+        bool m_headless;
         bool m_fullScreen;
         bool m_closeRequested;
         sf::Color m_clearColor = sf::Color::Black;
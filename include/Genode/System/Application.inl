@@ -63,14 +63,21 @@ namespace Gx
     std::enable_if_t<std::is_base_of_v<Module, TModule>, bool>
     Application::Uninstall()
     {
-        const auto key = std::type_index(typeid(TModule));
+        const auto module = FindModule<TModule>();
+        if (!module)
+            return false;
+
         for (auto it = m_modules.begin(); it != m_modules.end(); ++it)
         {
-            if (it->Type == key)
-                return m_modules.erase(it) != m_modules.end();
+            if (it->Instance == module)
+            {
+                m_modules.erase(it);
+                break;
+            }
         }
 
-        return false;
+        m_slots[GetModuleSlot<TModule>()] = nullptr;
+        return true;
     }
 
     template <typename TModule>
@@ -96,8 +103,12 @@ namespace Gx
     void Application::AddModule()
     {
         auto& module = m_context.Require<TModule>();
+        const auto slot = GetModuleSlot<TModule>();
+        if (slot >= m_slots.size())
+            m_slots.resize(slot + 1, nullptr);
+
+        m_slots[slot] = &module;
         m_modules.push_back(InternalModule{
-            std::type_index(typeid(TModule)),
             &module,
             dynamic_cast<Renderable*>(&module),
             dynamic_cast<Updatable*>(&module),
@@ -108,13 +119,14 @@ namespace Gx
     template <typename TModule>
     TModule* Application::FindModule() const
     {
-        const auto key = std::type_index(typeid(TModule));
-        for (const auto& entry : m_modules)
-        {
-            if (entry.Type == key)
-                return static_cast<TModule*>(entry.Instance);
-        }
+        const auto slot = GetModuleSlot<TModule>();
+        return slot < m_slots.size() ? static_cast<TModule*>(m_slots[slot]) : nullptr;
+    }
 
-        return nullptr;
+    template <typename TModule>
+    std::size_t Application::GetModuleSlot()
+    {
+        static const std::size_t slot = m_nextModuleSlot++;
+        return slot;
     }
 }
@@ -2,8 +2,10 @@
 
 #include <Genode/System/Module.hpp>
 
+#include <atomic>
 #include <memory>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 #include <vector>
 #include <typeindex>
@@ -98,7 +100,8 @@ namespace Gx
 
         Context(Context&& other) noexcept
             : m_parent(other.m_parent),
-              m_entries(std::move(other.m_entries))
+              m_entries(std::move(other.m_entries)),
+              m_resolved(std::move(other.m_resolved))
         {}
 
         Context& operator=(Context&& other) noexcept
@@ -106,8 +109,9 @@ namespace Gx
             if (this != &other)
             {
                 m_parent  = other.m_parent;
-                m_entries = std::move(other.m_entries);
-                m_current = nullptr;
+                m_entries  = std::move(other.m_entries);
+                m_resolved = std::move(other.m_resolved);
+                m_current  = nullptr;
             }
             return *this;
         }
@@ -138,31 +142,43 @@ namespace Gx
         template <typename T>
         [[nodiscard]] std::unique_ptr<T> Instantiate() const;
 
+        // Entries are not copied, the scope falls back to its parents and only materializes an entry when it is
+        // looked up: singletons are shared with the parent and locals are cloned without their instance.
         [[nodiscard]] Context CreateScope() const
         {
             Context scope;
             scope.m_parent = const_cast<Context*>(this);
-            for (auto& [key, entry] : m_entries)
-            {
-                if (entry->Lifetime == Scope::Singleton)
-                    scope.m_entries[key] = entry;
-                else
-                    scope.m_entries[key] = entry->Clone(true);
-            }
             return scope;
         }
 
         [[nodiscard]] Context Capture() const
         {
+            const auto lock = LockAccess();
+
             Context captured;
             captured.m_parent = nullptr;
 
             for (auto& [key, entry] : m_entries)
                 captured.m_entries[key] = entry->Clone(false);
 
+            // Include what this scope would inherit, as it would have been materialized on lookup
+            for (auto parent = m_parent; parent; parent = parent->m_parent)
+            {
+                for (auto& [key, entry] : parent->m_entries)
+                {
+                    if (captured.m_entries.find(key) == captured.m_entries.end())
+                        captured.m_entries[key] = entry->Clone(entry->Lifetime == Scope::Local);
+                }
+            }
+
             return captured;
         }
 
+        // Contexts are not thread-safe on their own. While another thread may resolve services (e.g. a scene loading
+        // in the background), every lookup and registration is serialized through a process-wide lock instead.
+        static void BeginConcurrentAccess();
+        static void EndConcurrentAccess();
+
     private:
         struct Scopable
         {
@@ -195,8 +211,28 @@ namespace Gx
         template <typename T>
         void ProvideDefault(std::type_index key) const;
 
+        // Dense per-type index into m_resolved, assigned on first use
+        template <typename T>
+        static std::size_t GetSlot();
+
+        template <typename T>
+        Service<T>* GetResolved() const;
+
+        template <typename T>
+        void Resolve(std::type_index key) const;
+
+        template <typename T>
+        void Unresolve() const;
+
+        [[nodiscard]] static std::unique_lock<std::recursive_mutex> LockAccess();
+
+        inline static std::atomic<std::size_t> m_nextSlot = 0;
+        inline static std::atomic<std::size_t> m_concurrentAccess = 0;
+        inline static std::recursive_mutex      m_accessMutex;
+
         Context*            m_parent;
         mutable ScopableMap m_entries;
+        mutable std::vector<std::shared_ptr<Scopable>> m_resolved;
         mutable Scopable*   m_current = nullptr;
     };
 }
@@ -15,11 +15,13 @@ namespace Gx
     template <typename T, std::enable_if_t<Context::IsConstructible<T>, int>>
     void Context::Provide(Scope scope)
     {
+        const auto lock = LockAccess();
         const auto key = std::type_index(typeid(T));
         auto svc       = std::make_shared<Service<T>>();
         svc->Lifetime  = scope;
         svc->Builder   = CreateBuilder<T>();
         m_entries[key] = std::move(svc);
+        Unresolve<T>();
     }
 
     template <typename TInterface, typename TConcrete,
@@ -30,6 +32,7 @@ namespace Gx
     >
     void Context::Provide(Scope scope)
     {
+        const auto lock = LockAccess();
         const auto key = std::type_index(typeid(TInterface));
         auto svc       = std::make_shared<Service<TInterface>>();
         svc->Lifetime  = scope;
@@ -38,40 +41,42 @@ namespace Gx
             return CreateBuilder<TConcrete>()(c);
         };
         m_entries[key] = std::move(svc);
+        Unresolve<TInterface>();
     }
 
     template <typename T>
     void Context::Provide(std::function<std::unique_ptr<T>(const Context&)> builder, Scope scope)
     {
+        const auto lock = LockAccess();
         const auto key = std::type_index(typeid(T));
         auto svc       = std::make_shared<Service<T>>();
         svc->Lifetime  = scope;
         svc->Builder   = std::move(builder);
         m_entries[key] = std::move(svc);
+        Unresolve<T>();
     }
 
     template <typename T>
     std::enable_if_t<!std::is_pointer_v<T>, T&>
     Context::Require() const
     {
+        const auto lock = LockAccess();
         using Type = std::remove_cv_t<std::remove_reference_t<T>>;
-        const auto key = std::type_index(typeid(Type));
+        if (auto* svc = GetResolved<Type>())
+            return *svc->Instance;
 
+        const auto key = std::type_index(typeid(Type));
         if (auto* svc = GetService<Type>(key))
         {
-            if (svc->Instance)
+            if (!svc->Instance)
             {
-                if (m_current)
-                    m_current->Dependencies.push_back(m_entries[key]);
-
-                return *svc->Instance;
+                auto* prev = m_current;
+                m_current = svc;
+                svc->Instance = svc->Builder(*this);
+                m_current = prev;
             }
 
-            auto* prev = m_current;
-            m_current = svc;
-            svc->Instance = svc->Builder(*this);
-            m_current = prev;
-
+            Resolve<Type>(key);
             if (m_current)
                 m_current->Dependencies.push_back(m_entries[key]);
 
@@ -95,24 +100,23 @@ namespace Gx
     std::enable_if_t<std::is_pointer_v<T>, T>
     Context::Require() const
     {
+        const auto lock = LockAccess();
         using Type = std::remove_cv_t<std::remove_pointer_t<T>>;
-        const auto key = std::type_index(typeid(Type));
+        if (auto* svc = GetResolved<Type>())
+            return svc->Instance.get();
 
+        const auto key = std::type_index(typeid(Type));
         if (auto* svc = GetService<Type>(key))
         {
-            if (svc->Instance)
+            if (!svc->Instance)
             {
-                if (m_current)
-                    m_current->Dependencies.push_back(m_entries[key]);
-
-                return svc->Instance.get();
+                auto* prev = m_current;
+                m_current = svc;
+                svc->Instance = svc->Builder(*this);
+                m_current = prev;
             }
 
-            auto* prev = m_current;
-            m_current = svc;
-            svc->Instance = svc->Builder(*this);
-            m_current = prev;
-
+            Resolve<Type>(key);
             if (m_current)
                 m_current->Dependencies.push_back(m_entries[key]);
 
@@ -125,6 +129,7 @@ namespace Gx
     template <typename T>
     std::unique_ptr<T> Context::Instantiate() const
     {
+        const auto lock = LockAccess();
         using Type = std::remove_cv_t<std::remove_reference_t<T>>;
         const auto key = std::type_index(typeid(Type));
 
@@ -179,12 +184,14 @@ namespace Gx
         if (const auto it = m_entries.find(key); it != m_entries.end())
             return static_cast<Service<T>*>(it->second.get());
 
-        if (m_parent)
+        for (auto parent = m_parent; parent; parent = parent->m_parent)
         {
-            if (auto* svc = m_parent->GetService<T>(key); svc && svc->Lifetime == Scope::Singleton)
+            if (const auto it = parent->m_entries.find(key); it != parent->m_entries.end())
             {
-                m_entries[key] = m_parent->m_entries[key];
-                return svc;
+                auto& entry = m_entries[key];
+                entry = it->second->Lifetime == Scope::Singleton ? it->second : it->second->Clone(true);
+
+                return static_cast<Service<T>*>(entry.get());
             }
         }
 
@@ -200,6 +207,62 @@ namespace Gx
         m_entries[key] = std::move(svc);
     }
 
+    inline void Context::BeginConcurrentAccess()
+    {
+        m_concurrentAccess++;
+    }
+
+    inline void Context::EndConcurrentAccess()
+    {
+        m_concurrentAccess--;
+    }
+
+    inline std::unique_lock<std::recursive_mutex> Context::LockAccess()
+    {
+        // Access only turns concurrent from the thread that spawns the other, so skipping the lock here is safe
+        if (m_concurrentAccess == 0)
+            return {};
+
+        return std::unique_lock(m_accessMutex);
+    }
+
+    template <typename T>
+    std::size_t Context::GetSlot()
+    {
+        static const std::size_t slot = m_nextSlot++;
+        return slot;
+    }
+
+    template <typename T>
+    Context::Service<T>* Context::GetResolved() const
+    {
+        const auto slot = GetSlot<T>();
+        if (slot >= m_resolved.size() || !m_resolved[slot])
+            return nullptr;
+
+        if (m_current)
+            m_current->Dependencies.push_back(m_resolved[slot]);
+
+        return static_cast<Service<T>*>(m_resolved[slot].get());
+    }
+
+    template <typename T>
+    void Context::Resolve(const std::type_index key) const
+    {
+        const auto slot = GetSlot<T>();
+        if (slot >= m_resolved.size())
+            m_resolved.resize(slot + 1);
+
+        m_resolved[slot] = m_entries[key];
+    }
+
+    template <typename T>
+    void Context::Unresolve() const
+    {
+        if (const auto slot = GetSlot<T>(); slot < m_resolved.size())
+            m_resolved[slot] = nullptr;
+    }
+
     template <typename Owner>
     template <typename T, typename>
     Context::Resolver<Owner>::operator T& () const
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Gx
+{
+    // Fixed set of worker threads that execute indexed jobs in parallel. The calling thread participates and Run only
+    // returns once every job completed, the first exception thrown by a job is rethrown on the calling thread.
+    // Run called from within a job executes inline, so nested parallel work never deadlocks.
+    class WorkerPool
+    {
+    public:
+        explicit WorkerPool(std::size_t workers);
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        // Shared pool with one worker less than the hardware concurrency, the calling thread makes up for it
+        [[nodiscard]] static WorkerPool& GetShared();
+
+        [[nodiscard]] std::size_t GetWorkerCount() const;
+
+        void Run(std::size_t count, const std::function<void(std::size_t)>& job);
+
+    private:
+        void Work();
+        void Execute();
+
+        std::vector<std::thread> m_threads{};
+        std::mutex m_runMutex{};
+        std::mutex m_mutex{};
+        std::condition_variable m_wake{};
+        std::condition_variable m_done{};
+
+        const std::function<void(std::size_t)>* m_job{nullptr};
+        std::size_t m_count{0};
+        std::atomic<std::size_t> m_next{0};
+        std::size_t m_active{0};
+        std::uint64_t m_generation{0};
+        bool m_stopping{false};
+        std::exception_ptr m_error{};
+    };
+}
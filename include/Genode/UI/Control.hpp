@@ -10,6 +10,7 @@
 
 namespace Gx
 {
+    class UiContainer;
     class Control : public virtual Node, public virtual RenderableContainer, public virtual UpdatableContainer, public virtual InputableContainer
     {
     public:
@@ -41,6 +42,8 @@ namespace Gx
         void SetVisible(bool visible) override;
 
     protected:
+        friend class UiContainer;
+
         Control();
         Control(const Control&) = default;
         Control(Control&&) = default;
@@ -50,6 +53,15 @@ namespace Gx
         [[nodiscard]] virtual State GetControlState() const;
         virtual void SetControlState(const State& state);
 
+        // Whether the control still expects pointer events outside of its bounds, e.g. to leave the hover state
+        [[nodiscard]] virtual bool IsPointerEngaged() const;
+
+        // Notifies the ancestor controls that the hit area of this control may have changed (bounds, transform,
+        // visibility or enabled state), implementations of Invalidate are expected to call it. Invalidations caused
+        // by a state change are ignored, the pointer engagement is tracked by the container routing the input.
+        void InvalidateHitArea() const;
+        virtual void OnHitAreaChanged();
+
         [[nodiscard]] const std::function<void(Control&, Event&)>& GetFocusChangedCallback() const;
         [[nodiscard]] const std::function<void(Control&, Event&)>& GetGainFocusCallback() const;
         [[nodiscard]] const std::function<void(Control&, Event&)>& GetLostFocusCallback() const;
@@ -69,6 +81,7 @@ namespace Gx
 
         void OnChildAdded(Node& node) override;
         void OnChildRemove(Node& node) override;
+        void OnTransformChanged() override;
 
         virtual void OnControlChildAdded(Control& control);
         virtual void OnControlChildRemove(Control& control);
@@ -84,6 +97,8 @@ namespace Gx
         constexpr static double DOUBLE_CLICK_THRESHOLD = 500.f;
         constexpr static double HOLD_CLICK_THRESHOLD   = 50.f;
 
+        [[nodiscard]] Control* GetParentControl() const;
+
         State  m_state;
         bool   m_enabled, m_focused, m_clicked, m_doubleClicked;
         double m_deltaClickDuration, m_deltaHoldDuration;
@@ -4,6 +4,7 @@
 
 #include <Genode/UI/Control.hpp>
 #include <Genode/Graphics/Sprite.hpp>
+#include <Genode/Graphics/TextureRegion.hpp>
 
 #include <unordered_map>
 
@@ -31,9 +32,11 @@ namespace Gx
         Image();
         explicit Image(const sf::Texture& texture);
         Image(const sf::Texture& texture, const sf::IntRect& rectangle);
+        explicit Image(const TextureRegion& region);
 
         [[nodiscard]] sf::FloatRect GetLocalBounds() const override;
         [[nodiscard]] sf::FloatRect GetGlobalBounds() const override;
+        [[nodiscard]] std::optional<sf::FloatRect> GetRenderBounds() const override;
 
         [[nodiscard]] const sf::Texture* GetTexture() const;
         [[nodiscard]] const sf::IntRect& GetTexCoords() const;
@@ -42,6 +45,7 @@ namespace Gx
         [[nodiscard]] BlendMode GetBlendMode() const;
 
         void SetTexture(const sf::Texture& texture, bool resetRect = false);
+        void SetTexture(const TextureRegion& region);
         void SetTexCoords(const sf::IntRect& rectangle);
         void SetLocalBounds(const sf::FloatRect& bounds);
         void SetColor(const sf::Color& color) override;
@@ -27,11 +27,20 @@ namespace Gx
         [[nodiscard]] virtual bool IsBatchingEnabled() const;
         virtual void SetBatchingEnabled(bool batchingEnabled);
 
+        // Route mouse movement through a uniform grid of child bounds instead of broadcasting it to every child
+        [[nodiscard]] bool IsHitTestIndexed() const;
+        void SetHitTestIndexed(bool indexed);
+
         void Apply(const std::function<void(Control&)>& fun) const;
 
     protected:
         RenderStates Render(RenderSurface& surface, RenderStates states) const override;
         void Update(const sf::Time& delta) override;
+        bool Input(const sf::Event& ev) override;
+
+        [[nodiscard]] bool IsPointerEngaged() const override;
+        void OnHitAreaChanged() override;
+        void OnWorldTransformInvalidated() override;
 
         void OnControlClick(Control& sender, const sf::Event::MouseButtonReleased& ev) override;
         void OnKeyPressed(const sf::Event::KeyPressed& ev) override;
@@ -39,9 +48,36 @@ namespace Gx
         void Invalidate() override;
 
     private:
+        struct HitEntry
+        {
+            Inputable*    Instance{nullptr};
+            Control*      AsControl{nullptr};
+            sf::FloatRect Bounds{};
+        };
+
+        constexpr static std::size_t HIT_GRID_MAX_CELLS = 64;
+
+        [[nodiscard]] static sf::FloatRect GetHitBounds(const Control& control);
+
+        void BuildHitGrid();
+        void UpdateHitEngagement();
+        void RouteInput(const sf::Event& ev, const sf::Vector2f& position);
+
         sf::FloatRect m_computedLocalBounds;
         sf::FloatRect m_computedGlobalBounds;
         sf::FloatRect m_localBounds;
         bool m_useBatching{false};
+
+        bool m_hitTestIndexed{false};
+        bool m_hitGridDirty{true};
+        std::uint64_t m_hitGridVersion{0};
+        sf::FloatRect m_hitGridArea{};
+        sf::Vector2f m_hitCellSize{};
+        sf::Vector2<std::size_t> m_hitGridSize{};
+        std::vector<HitEntry> m_hitEntries{};
+        std::vector<std::vector<std::size_t>> m_hitCells{};
+        std::vector<std::size_t> m_hitAlways{};
+        std::vector<std::size_t> m_hitEngaged{};
+        std::vector<std::size_t> m_hitRouted{};
     };
 }
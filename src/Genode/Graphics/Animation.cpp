@@ -32,6 +32,23 @@ namespace Gx
     {
     }
 
+    Animation::Animation(const TextureRegion& region, const sf::Time& duration, const std::initializer_list<Frame> frames) :
+        Gx::Sprite(region),
+        m_state(AnimationState::Initial),
+        m_duration(duration),
+        m_elapsed(sf::Time::Zero),
+        m_speed(1.f),
+        m_currentFrame(0),
+        m_currentRepeat(0),
+        m_repeatCount(0),
+        m_loop(false),
+        m_frames(frames),
+        m_animationCallback()
+    {
+        for (auto& frame : m_frames)
+            frame.TexCoords = region.Map(frame.TexCoords);
+    }
+
     void Animation::AddFrame(const Frame& frame)
     {
         m_frames.push_back(frame);
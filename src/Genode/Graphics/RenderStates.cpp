@@ -36,10 +36,11 @@ namespace Gx
     {
     }
 
-    RenderStates::RenderStates(const sf::RenderStates& states, const unsigned int frameID, const sf::Time& delta) :
+    RenderStates::RenderStates(const sf::RenderStates& states, const unsigned int frameID, const sf::Time& delta, const float alpha) :
         sf::RenderStates(states),
         FrameID(frameID),
-        Delta(delta)
+        Delta(delta),
+        Alpha(alpha)
     {
     }
 
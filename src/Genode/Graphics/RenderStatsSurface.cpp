@@ -0,0 +1,202 @@
+#include <Genode/Graphics/RenderStatsSurface.hpp>
+#include <Genode/Entities/Renderable.hpp>
+
+namespace Gx
+{
+    RenderStatsSurface::RenderStatsSurface(RenderSurface& surface, const std::size_t historySize) :
+        m_surface(&surface),
+        m_current(),
+        m_last(),
+        m_history(),
+        m_historySize(historySize),
+        m_hasState(false),
+        m_texture(nullptr),
+        m_blendMode(),
+        m_shader(nullptr)
+    {
+    }
+
+    void RenderStatsSurface::EndFrame()
+    {
+        m_last = m_current;
+        if (m_historySize > 0)
+        {
+            m_history.push_back(m_current);
+            while (m_history.size() > m_historySize)
+                m_history.pop_front();
+        }
+
+        m_current  = RenderStats();
+        m_hasState = false;
+    }
+
+    const RenderStats& RenderStatsSurface::GetStats() const
+    {
+        return m_last;
+    }
+
+    const RenderStats& RenderStatsSurface::GetCurrentStats() const
+    {
+        return m_current;
+    }
+
+    const std::deque<RenderStats>& RenderStatsSurface::GetHistory() const
+    {
+        return m_history;
+    }
+
+    std::size_t RenderStatsSurface::GetHistorySize() const
+    {
+        return m_historySize;
+    }
+
+    void RenderStatsSurface::SetHistorySize(const std::size_t historySize)
+    {
+        m_historySize = historySize;
+        while (m_history.size() > m_historySize)
+            m_history.pop_front();
+    }
+
+    RenderSurface& RenderStatsSurface::GetSurface() const
+    {
+        return *m_surface;
+    }
+
+    void RenderStatsSurface::Clear()
+    {
+        m_current.Clears++;
+        m_surface->Clear();
+    }
+
+    void RenderStatsSurface::Clear(const sf::Color clearColor)
+    {
+        m_current.Clears++;
+        m_surface->Clear(clearColor);
+    }
+
+    void RenderStatsSurface::Clear(const sf::Color clearColor, const sf::StencilValue stencilValue)
+    {
+        m_current.Clears++;
+        m_surface->Clear(clearColor, stencilValue);
+    }
+
+    void RenderStatsSurface::Render(const Renderable& renderable, const RenderStates& states)
+    {
+        // Rendered through this surface, so the draws of the renderable are counted as well
+        renderable.Render(*this, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::Vertex* vertices, const std::size_t vertexCount, const sf::PrimitiveType type, const RenderStates& states)
+    {
+        Record(type, vertexCount, states);
+        m_surface->Render(vertices, vertexCount, type, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::Vertex*       vertices,
+                                    const std::size_t       vertexCount,
+                                    const sf::PrimitiveType type,
+                                    const std::uint64_t     version,
+                                    const RenderStates&     states)
+    {
+        Record(type, vertexCount, states);
+        m_surface->Render(vertices, vertexCount, type, version, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::Vertex*    vertices,
+                                    const std::size_t    vertexCount,
+                                    const std::uint32_t* indices,
+                                    const std::size_t    indexCount,
+                                    const RenderStates&  states)
+    {
+        Record(sf::PrimitiveType::Triangles, vertexCount, states);
+        m_current.IndexedDrawCalls++;
+        m_current.Indices += indexCount;
+
+        m_surface->Render(vertices, vertexCount, indices, indexCount, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::Vertex*    vertices,
+                                    const std::size_t    vertexCount,
+                                    const std::uint16_t* indices,
+                                    const std::size_t    indexCount,
+                                    const RenderStates&  states)
+    {
+        Record(sf::PrimitiveType::Triangles, vertexCount, states);
+        m_current.IndexedDrawCalls++;
+        m_current.Indices += indexCount;
+
+        m_surface->Render(vertices, vertexCount, indices, indexCount, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::VertexBuffer& vertexBuffer, const RenderStates& states)
+    {
+        Record(vertexBuffer.getPrimitiveType(), vertexBuffer.getVertexCount(), states);
+        m_current.VertexBufferDraws++;
+
+        m_surface->Render(vertexBuffer, states);
+    }
+
+    void RenderStatsSurface::Render(const sf::VertexBuffer& vertexBuffer, const std::size_t firstVertex, const std::size_t vertexCount, const RenderStates& states)
+    {
+        Record(vertexBuffer.getPrimitiveType(), vertexCount, states);
+        m_current.VertexBufferDraws++;
+
+        m_surface->Render(vertexBuffer, firstVertex, vertexCount, states);
+    }
+
+    void RenderStatsSurface::NotifyUpload(const std::size_t vertexCount)
+    {
+        m_current.VertexBufferUploads++;
+        m_current.UploadedVertices += vertexCount;
+
+        m_surface->NotifyUpload(vertexCount);
+    }
+
+    const sf::View& RenderStatsSurface::GetDefaultView() const
+    {
+        return m_surface->GetDefaultView();
+    }
+
+    const sf::View& RenderStatsSurface::GetView() const
+    {
+        return m_surface->GetView();
+    }
+
+    void RenderStatsSurface::SetView(const sf::View& view)
+    {
+        m_surface->SetView(view);
+    }
+
+    std::optional<sf::FloatRect> RenderStatsSurface::GetViewBounds() const
+    {
+        return m_surface->GetViewBounds();
+    }
+
+    void RenderStatsSurface::Record(const sf::PrimitiveType type, const std::size_t vertexCount, const RenderStates& states)
+    {
+        m_current.DrawCalls++;
+        m_current.Vertices += vertexCount;
+
+        const auto primitive = static_cast<std::size_t>(type);
+        if (primitive < m_current.Primitives.size())
+            m_current.Primitives[primitive]++;
+
+        // The first draw of a frame sets the state, only changes after it count as switches
+        if (m_hasState)
+        {
+            if (states.texture != m_texture)
+                m_current.TextureSwitches++;
+
+            if (states.blendMode != m_blendMode)
+                m_current.BlendModeSwitches++;
+
+            if (states.shader != m_shader)
+                m_current.ShaderSwitches++;
+        }
+
+        m_hasState  = true;
+        m_texture   = states.texture;
+        m_blendMode = states.blendMode;
+        m_shader    = states.shader;
+    }
+}
@@ -238,16 +238,7 @@ namespace Gx
     ////////////////////////////////////////////////////////////
     sf::FloatRect Shape::GetGlobalBounds() const
     {
-        auto parent    = GetParent();
-        auto transform = sf::Transform::Identity;
-        while (parent)
-        {
-            transform *= parent->GetTransform();
-            parent = parent->GetParent();
-        }
-
-        transform *= GetTransform();
-        return transform.transformRect(GetLocalBounds());
+        return GetWorldTransform().transformRect(GetLocalBounds());
     }
 
 
@@ -51,6 +51,15 @@ namespace Gx
     }
 
 
+    ////////////////////////////////////////////////////////////
+    Sprite::Sprite(const TextureRegion& region) :
+        m_texture(region.Texture),
+        m_texcoords(region.TexCoords)
+    {
+        UpdateVertices();
+    }
+
+
     ////////////////////////////////////////////////////////////
     void Sprite::SetTexture(const sf::Texture& texture, const bool resetRect)
     {
@@ -63,6 +72,14 @@ namespace Gx
     }
 
 
+    ////////////////////////////////////////////////////////////
+    void Sprite::SetTexture(const TextureRegion& region)
+    {
+        m_texture = region.Texture;
+        SetTexCoords(region.TexCoords);
+    }
+
+
     ////////////////////////////////////////////////////////////
     void Sprite::SetTexCoords(const sf::IntRect& rectangle)
     {
@@ -79,6 +96,8 @@ namespace Gx
     {
         for (auto& vertex : m_vertices)
             vertex.color = color;
+
+        InvalidateRenderVersion();
     }
 
 
@@ -128,16 +147,17 @@ namespace Gx
     ////////////////////////////////////////////////////////////
     sf::FloatRect Sprite::GetGlobalBounds() const
     {
-        auto parent    = GetParent();
-        auto transform = sf::Transform::Identity;
-        while (parent)
-        {
-            transform *= parent->GetTransform();
-            parent = parent->GetParent();
-        }
+        return GetWorldTransform().transformRect(GetLocalBounds());
+    }
 
-        transform *= GetTransform();
-        return transform.transformRect(GetLocalBounds());
+
+    ////////////////////////////////////////////////////////////
+    std::optional<sf::FloatRect> Sprite::GetRenderBounds() const
+    {
+        if (GetChildrenCount() > 0)
+            return std::nullopt;
+
+        return GetTransform().transformRect(GetLocalBounds());
     }
 
 
@@ -163,7 +183,7 @@ namespace Gx
         if (m_texture)
         {
             states.texture = m_texture;
-            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, states);
+            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, GetRenderVersion(), states);
         }
 
         return RenderableContainer::Render(surface, states);
@@ -189,5 +209,7 @@ namespace Gx
         m_vertices[1].texCoords = position + sf::Vector2f(0.f, size.y);
         m_vertices[2].texCoords = position + sf::Vector2f(size.x, 0.f);
         m_vertices[3].texCoords = position + size;
+
+        InvalidateRenderVersion();
     }
 }
@@ -27,6 +27,8 @@
 ////////////////////////////////////////////////////////////
 
 #include <Genode/Graphics/SpriteBatch.hpp>
+#include <Genode/Graphics/VertexBufferAdaptor.hpp>
+#include <Genode/Graphics/VertexTransform.hpp>
 #include <Genode/System/Exception.hpp>
 
 #include <SFML/Graphics/Font.hpp>
@@ -34,11 +36,96 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <algorithm>
+#include <array>
 #include <cstring>
+#include <limits>
 #include <numeric>
 
 namespace Gx
 {
+    namespace
+    {
+        constexpr auto UnassignedIndex = std::numeric_limits<std::uint32_t>::max();
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Maps a float onto an unsigned integer that sorts in
+        ///        the same order as the float itself
+        ///
+        ////////////////////////////////////////////////////////////
+        std::uint32_t ToOrderedBits(float value)
+        {
+            // Fold -0 into +0 so both land in the same layer
+            value += 0.f;
+
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+        }
+
+        ////////////////////////////////////////////////////////////
+        /// @brief Sorts values by key with a stable LSD radix sort,
+        ///        8 bits per pass. Passes where every key shares the
+        ///        same digit are skipped.
+        ///
+        ////////////////////////////////////////////////////////////
+        void RadixSort(std::vector<std::uint64_t>& keys,
+                       std::vector<std::size_t>&   values,
+                       std::vector<std::uint64_t>& keysBuffer,
+                       std::vector<std::size_t>&   valuesBuffer)
+        {
+            constexpr std::size_t digits = sizeof(std::uint64_t);
+            const std::size_t     count  = keys.size();
+
+            std::array<std::array<std::size_t, 256>, digits> histograms{};
+            for (const std::uint64_t key : keys)
+            {
+                for (std::size_t digit = 0; digit < digits; digit++)
+                    histograms[digit][(key >> (digit * 8)) & 0xFF]++;
+            }
+
+            keysBuffer.resize(count);
+            valuesBuffer.resize(count);
+
+            for (std::size_t digit = 0; digit < digits; digit++)
+            {
+                auto& histogram = histograms[digit];
+                if (histogram[(keys.front() >> (digit * 8)) & 0xFF] == count)
+                    continue;
+
+                std::size_t offset = 0;
+                for (auto& bucket : histogram)
+                {
+                    const std::size_t size = bucket;
+                    bucket  = offset;
+                    offset += size;
+                }
+
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    const std::size_t position = histogram[(keys[i] >> (digit * 8)) & 0xFF]++;
+                    keysBuffer[position]   = keys[i];
+                    valuesBuffer[position] = values[i];
+                }
+
+                keys.swap(keysBuffer);
+                values.swap(valuesBuffer);
+            }
+        }
+    }
+
+    std::size_t SpriteBatch::StateHash::operator()(const StateInfo& state) const
+    {
+        const auto& blend = state.blendMode;
+        std::size_t hash  = std::hash<const void*>()(state.texture) ^ (std::hash<const void*>()(state.shader) << 1);
+        for (const auto value : {static_cast<int>(blend.colorSrcFactor), static_cast<int>(blend.colorDstFactor), static_cast<int>(blend.colorEquation),
+                                 static_cast<int>(blend.alphaSrcFactor), static_cast<int>(blend.alphaDstFactor), static_cast<int>(blend.alphaEquation)})
+            hash = hash * 31 + static_cast<std::size_t>(value);
+
+        return hash;
+    }
+
+    ////////////////////////////////////////////////////////////
     SpriteBatch::SpriteBatch(const Mode batchMode) :
         m_batchMode(batchMode)
     {
@@ -58,10 +145,16 @@ namespace Gx
         UpdatableContainer(other),
         m_triangles(other.m_triangles),
         m_unsortedVertices(other.m_unsortedVertices),
-        m_flushedTriangles(other.m_flushedTriangles),
+        m_unsortedIndices(other.m_unsortedIndices),
+        m_runs(other.m_runs),
+        m_dirtyRuns(other.m_dirtyRuns),
+        m_runCursor(other.m_runCursor),
+        m_states(other.m_states),
+        m_stateIds(other.m_stateIds),
         m_batchMode(other.m_batchMode),
         m_batchUsage(other.m_batchUsage),
-        m_blendMode(other.m_blendMode)
+        m_geometry(other.m_geometry),
+        m_indexFormat(other.m_indexFormat)
     {
     }
 
@@ -82,13 +175,25 @@ namespace Gx
 
         m_triangles        = other.m_triangles;
         m_unsortedVertices = other.m_unsortedVertices;
-        m_flushedTriangles  = other.m_flushedTriangles;
+        m_unsortedIndices  = other.m_unsortedIndices;
+        m_runs             = other.m_runs;
+        m_dirtyRuns        = other.m_dirtyRuns;
+        m_runCursor        = other.m_runCursor;
+        m_states           = other.m_states;
+        m_stateIds         = other.m_stateIds;
         m_batchMode        = other.m_batchMode;
         m_batchUsage       = other.m_batchUsage;
-        m_blendMode        = other.m_blendMode;
+        m_geometry         = other.m_geometry;
+        m_indexFormat      = other.m_indexFormat;
         m_rebuildRequired  = true;
+        m_uploaded         = false;
         m_batches.clear();
         m_order.clear();
+        m_inverseOrder.clear();
+        m_vertexOrder.clear();
+        m_indices.clear();
+        m_shortIndices.clear();
+        m_dirtyRanges.clear();
 
         return *this;
     }
@@ -98,13 +203,18 @@ namespace Gx
     {
         m_batchMode       = batchMode;
         m_rebuildRequired = true;
+        m_uploaded        = false;
     }
 
     ////////////////////////////////////////////////////////////
     void SpriteBatch::SetBatchUsage(const Usage batchUsage)
     {
+        if (batchUsage == Usage::Static && m_geometry == Geometry::Indexed)
+            throw NotSupportedException("Static batch usage does not support indexed geometry");
+
         m_batchUsage      = batchUsage;
         m_rebuildRequired = true;
+        m_uploaded        = false;
     }
 
     ////////////////////////////////////////////////////////////
@@ -113,12 +223,130 @@ namespace Gx
         return m_batchUsage;
     }
 
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::SetBatchGeometry(const Geometry geometry)
+    {
+        if (m_geometry == geometry)
+            return;
+
+        if (geometry == Geometry::Indexed && m_batchUsage == Usage::Static)
+            throw NotSupportedException("Static batch usage does not support indexed geometry");
+
+        // Batched data is laid out differently for each geometry
+        ClearBatch();
+        m_geometry = geometry;
+    }
+
+    ////////////////////////////////////////////////////////////
+    SpriteBatch::Geometry SpriteBatch::GetBatchGeometry() const
+    {
+        return m_geometry;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::SetIndexFormat(const IndexFormat format)
+    {
+        m_indexFormat     = format;
+        m_rebuildRequired = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    SpriteBatch::IndexFormat SpriteBatch::GetIndexFormat() const
+    {
+        return m_indexFormat;
+    }
+
     ////////////////////////////////////////////////////////////
     VertexPool& SpriteBatch::GetVertexPool()
     {
         return m_pool;
     }
 
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::SetVertexBufferStorage(std::unique_ptr<VertexBufferStorage> storage)
+    {
+        m_storage  = std::move(storage);
+        m_uploaded = false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    VertexBufferStorage* SpriteBatch::GetVertexBufferStorage() const
+    {
+        return m_storage.get();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::InvalidateBatch()
+    {
+        m_uploaded = false;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool SpriteBatch::IsSubmissionRequired() const
+    {
+        return m_batchUsage != Usage::Static || !m_uploaded || m_uploadedVersion != GetVersion();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::SetViewBounds(const std::optional<sf::FloatRect>& bounds)
+    {
+        m_viewBounds = bounds;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::optional<sf::FloatRect> SpriteBatch::GetViewBounds() const
+    {
+        if (!IsCulling() || m_batchUsage == Usage::Static)
+            return std::nullopt;
+
+        return m_viewBounds;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t SpriteBatch::GetCulledSubmissionCount() const
+    {
+        return m_lastCulledCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t SpriteBatch::GetDrawnSubmissionCount() const
+    {
+        return m_lastDrawnCount;
+    }
+
+    ////////////////////////////////////////////////////////////
+    const sf::Vertex* SpriteBatch::GetPreparedVertices() const
+    {
+        return m_span ? m_span->data() : nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////
+    std::size_t SpriteBatch::GetPreparedVertexCount() const
+    {
+        if (!m_span)
+            return 0;
+
+        return m_geometry == Geometry::Indexed ? m_vertexOrder.size() : m_order.size() * 3;
+    }
+
+    ////////////////////////////////////////////////////////////
+    const std::vector<std::uint32_t>& SpriteBatch::GetPreparedIndices() const
+    {
+        return m_indices;
+    }
+
+    ////////////////////////////////////////////////////////////
+    const std::vector<std::uint16_t>& SpriteBatch::GetPreparedShortIndices() const
+    {
+        return m_shortIndices;
+    }
+
+    ////////////////////////////////////////////////////////////
+    SpriteBatch::IndexFormat SpriteBatch::GetPreparedIndexFormat() const
+    {
+        return m_preparedIndexFormat;
+    }
+
     ////////////////////////////////////////////////////////////
     void SpriteBatch::Batch(const sf::VertexArray& vertices, const sf::Texture* texture, const sf::Transform& transform, const float layer)
     {
@@ -131,36 +359,156 @@ namespace Gx
                             const sf::PrimitiveType type,
                             const sf::Texture*      texture,
                             const sf::Transform&    transform,
-                            const float             layer)
+                            const float             layer,
+                            const std::uint64_t     version)
+    {
+        RenderStates states(texture);
+        states.transform = transform;
+        states.Layer     = layer;
+
+        Batch(vertices, count, type, states, version);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::Batch(const sf::Vertex*       vertices,
+                            const std::size_t       count,
+                            const sf::PrimitiveType type,
+                            const RenderStates&     states,
+                            const std::uint64_t     version)
     {
         if (type != sf::PrimitiveType::TriangleFan && type != sf::PrimitiveType::TriangleStrip && type != sf::PrimitiveType::Triangles)
            throw Exception("SpriteBatch supports only triangle-based primitive types");
 
         // Anything to batch?
-        if (count == 0)
+        const std::size_t triangleCount = type == sf::PrimitiveType::Triangles ? count / 3 : (count >= 3 ? count - 2 : 0);
+        if (triangleCount == 0)
             return;
 
-        // Split into triangles
-        switch (type)
+        const sf::Transform& transform = states.transform;
+        const bool           culled    = CullSubmission(vertices, count, transform);
+        const float          layer     = states.Layer;
+        const std::uint32_t  state     = FindState(states);
+
+        // Submissions that keep the structure of the last flush are written in place
+        if (m_runCursor < m_runs.size())
         {
-            case sf::PrimitiveType::TriangleStrip:
-                for (std::size_t i = 2; i < count; i++)
-                    PushTriangle(vertices[i - 2], vertices[i - 1], vertices[i], transform, texture, layer);
-
-                break;
-            case sf::PrimitiveType::TriangleFan:
-                for (std::size_t i = 2; i < count; i++)
-                    PushTriangle(vertices[0], vertices[i - 1], vertices[i], transform, texture, layer);
-
-                break;
-            case sf::PrimitiveType::Triangles:
-                for (std::size_t i = 2; i < count; i += 3)
-                    PushTriangle(vertices[i - 2], vertices[i - 1], vertices[i], transform, texture, layer);
-
-                break;
-            default:
-                throw Exception("A non-triangle primitive type was encountered when decomposing into triangles");
+            // Culled runs keep their place, but only those that still hold their triangles can be drawn again
+            auto& run = m_runs[m_runCursor];
+            if (run.state == state && run.level == layer && run.type == type && run.vertexCount == count &&
+                (culled || run.triangleCount > 0))
+            {
+                m_runCursor++;
+                if (culled)
+                {
+                    // Its triangles are left out of the prepared batch, which only takes a rebuild
+                    m_visibilityChanged = m_visibilityChanged || !run.culled;
+                    run.culled          = true;
+                    return;
+                }
+
+                // Versioned vertices that did not change since the last flush are skipped entirely
+                if (!run.culled && version != 0 && run.version == version && run.source == vertices && run.transform == transform)
+                    return;
+
+                m_visibilityChanged = m_visibilityChanged || run.culled;
+                run.culled          = false;
+                run.source          = vertices;
+                run.version         = version;
+                run.transform       = transform;
+                WriteRun(run, vertices);
+                m_dirtyRuns.push_back(m_runCursor - 1);
+
+                return;
+            }
+
+            // Anything batched past this point at the last flush is stale
+            TruncateRuns(m_runCursor);
+        }
+
+        RunInfo run;
+        run.source            = vertices;
+        run.version           = version;
+        run.transform         = transform;
+        run.state             = state;
+        run.level             = layer;
+        run.type              = type;
+        run.vertexCount       = count;
+        run.firstTriangle     = m_triangles.size();
+        run.triangleCount     = triangleCount;
+        run.firstVertex       = m_unsortedVertices.size();
+        run.storedVertexCount = m_geometry == Geometry::Indexed ? count : triangleCount * 3;
+
+        // Streamed batches are rebuilt every flush anyway, so their culled submissions only take a place in the run list
+        if (culled && m_batchUsage == Usage::Stream)
+        {
+            run.culled            = true;
+            run.triangleCount     = 0;
+            run.storedVertexCount = 0;
+
+            m_runs.push_back(run);
+            m_runCursor++;
+            m_structureChanged = true;
+            return;
+        }
+
+        m_triangles.insert(m_triangles.end(), triangleCount, TriangleInfo(state, layer));
+        m_unsortedVertices.resize(run.firstVertex + run.storedVertexCount);
+
+        // Other culled submissions reserve their place, so they can come into view without changing the structure
+        run.culled = culled;
+        if (!culled)
+            WriteRun(run, vertices);
+
+        // Store each vertex once and reference it from every triangle that shares it
+        if (m_geometry == Geometry::Indexed)
+        {
+            const auto base = static_cast<std::uint32_t>(run.firstVertex);
+            for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(triangleCount); i++)
+            {
+                switch (type)
+                {
+                    case sf::PrimitiveType::TriangleStrip:
+                        m_unsortedIndices.insert(m_unsortedIndices.end(), {base + i, base + i + 1, base + i + 2});
+                        break;
+                    case sf::PrimitiveType::TriangleFan:
+                        m_unsortedIndices.insert(m_unsortedIndices.end(), {base, base + i + 1, base + i + 2});
+                        break;
+                    default:
+                        m_unsortedIndices.insert(m_unsortedIndices.end(), {base + i * 3, base + i * 3 + 1, base + i * 3 + 2});
+                        break;
+                }
+            }
+        }
+
+        m_runs.push_back(run);
+        m_runCursor++;
+        m_structureChanged = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    bool SpriteBatch::CullSubmission(const sf::Vertex* vertices, const std::size_t count, const sf::Transform& transform)
+    {
+        if (const auto viewBounds = GetViewBounds())
+        {
+            sf::Vector2f min = vertices[0].position;
+            sf::Vector2f max = vertices[0].position;
+            for (std::size_t i = 1; i < count; i++)
+            {
+                min.x = std::min(min.x, vertices[i].position.x);
+                min.y = std::min(min.y, vertices[i].position.y);
+                max.x = std::max(max.x, vertices[i].position.x);
+                max.y = std::max(max.y, vertices[i].position.y);
+            }
+
+            if (RenderSurface::IsOutsideView(transform.transformRect(sf::FloatRect(min, max - min)), *viewBounds))
+            {
+                m_culledCount++;
+                return true;
+            }
         }
+
+        m_drawnCount++;
+        return false;
     }
 
     ////////////////////////////////////////////////////////////
@@ -176,17 +524,75 @@ namespace Gx
             return states;
 
         states.transform *= GetTransform();
-        states.blendMode  = m_blendMode.value_or(states.blendMode);
 
         auto& batcher = const_cast<SpriteBatch&>(*this);
+        if (m_batchUsage == Usage::Static)
+        {
+            // Keep drawing the uploaded batch until something invalidates it or submits to it
+            if (const bool submit = IsSubmissionRequired(); submit || m_runCursor > 0)
+            {
+                if (submit)
+                {
+                    auto localStates      = states;
+                    localStates.transform = sf::Transform::Identity;
+                    RenderChildren(batcher, localStates, std::nullopt);
+                }
+
+                batcher.TruncateRuns(m_runCursor);
+                const bool rebuild = m_rebuildRequired || m_structureChanged || m_visibilityChanged;
+                if (rebuild)
+                {
+                    batcher.CompactStates();
+                    RebuildBatch();
+                }
+                else
+                    RewriteVertices();
+
+                UploadBatch(surface, rebuild);
+                batcher.Flush();
+
+                m_rebuildRequired = false;
+                m_uploaded        = true;
+                m_uploadedVersion = GetVersion();
+                SetCullingCounters(m_lastCulledCount, m_lastDrawnCount);
+            }
+
+            auto cstates = states;
+            std::size_t startVertex = 0;
+            for (const auto& batch : m_batches)
+            {
+                cstates.texture   = batch.texture;
+                cstates.blendMode = batch.blendMode;
+                cstates.shader    = batch.shader;
+                m_storage->Render(surface, startVertex, batch.vertexCount, cstates);
+
+                startVertex += batch.vertexCount;
+            }
+
+            return states;
+        }
+
+        // Children are submitted in batch space, so the view is brought into it as well
+        if (IsCulling())
+        {
+            if (const auto viewBounds = surface.GetViewBounds())
+                batcher.SetViewBounds(states.transform.getInverse().transformRect(*viewBounds));
+        }
+
+        // Children are culled per submission by the batch, so their runs keep their place
         auto localStates      = states;
         localStates.transform = sf::Transform::Identity;
-        RenderableContainer::Render(batcher, localStates);
+        RenderChildren(batcher, localStates, std::nullopt);
 
         if (m_batchUsage == Usage::Dynamic)
         {
-            if (m_rebuildRequired || IsStructureChanged())
+            // Drop whatever was not submitted again since the last flush
+            batcher.TruncateRuns(m_runCursor);
+            if (m_rebuildRequired || m_structureChanged || m_visibilityChanged)
+            {
+                batcher.CompactStates();
                 RebuildBatch();
+            }
             else
                 RewriteVertices();
 
@@ -195,11 +601,14 @@ namespace Gx
         else
         {
             RebuildBatch();
-            batcher.m_triangles.clear();
-            batcher.m_unsortedVertices.clear();
+            batcher.TruncateRuns(0);
+            batcher.m_states.clear();
+            batcher.m_stateIds.clear();
+            batcher.Flush();
         }
 
         m_rebuildRequired = false;
+        SetCullingCounters(m_lastCulledCount, m_lastDrawnCount);
 
         auto cstates = states;
         if (const sf::Vertex* vertices = m_span ? m_span->data() : nullptr)
@@ -207,8 +616,15 @@ namespace Gx
             std::size_t startVertex = 0;
             for (const auto& batch : m_batches)
             {
-                cstates.texture = batch.texture;
-                surface.Render(vertices + startVertex, batch.vertexCount, sf::PrimitiveType::Triangles, cstates);
+                cstates.texture   = batch.texture;
+                cstates.blendMode = batch.blendMode;
+                cstates.shader    = batch.shader;
+                if (m_geometry == Geometry::Indexed && m_preparedIndexFormat == IndexFormat::UInt16)
+                    surface.Render(vertices, m_vertexOrder.size(), m_shortIndices.data() + startVertex, batch.vertexCount, cstates);
+                else if (m_geometry == Geometry::Indexed)
+                    surface.Render(vertices, m_vertexOrder.size(), m_indices.data() + startVertex, batch.vertexCount, cstates);
+                else
+                    surface.Render(vertices + startVertex, batch.vertexCount, sf::PrimitiveType::Triangles, cstates);
 
                 startVertex += batch.vertexCount;
             }
@@ -236,11 +652,17 @@ namespace Gx
     ////////////////////////////////////////////////////////////
     void SpriteBatch::Render(const sf::Vertex* vertices, const std::size_t vertexCount, const sf::PrimitiveType type, const RenderStates& states)
     {
-        if (m_blendMode.has_value() && m_blendMode != states.blendMode)
-            throw NotSupportedException("Multiple blending mode usage within single batch is not supported");
+        Render(vertices, vertexCount, type, 0, states);
+    }
 
-        m_blendMode = states.blendMode;
-        Batch(vertices, vertexCount, type, states.texture, states.transform, states.Layer);
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::Render(const sf::Vertex*       vertices,
+                             const std::size_t       vertexCount,
+                             const sf::PrimitiveType type,
+                             const std::uint64_t     version,
+                             const RenderStates&     states)
+    {
+        Batch(vertices, vertexCount, type, states, version);
     }
 
     ////////////////////////////////////////////////////////////
@@ -271,127 +693,350 @@ namespace Gx
     }
 
     ////////////////////////////////////////////////////////////
-    void SpriteBatch::PushTriangle(const sf::Vertex&    a,
-                                   const sf::Vertex&    b,
-                                   const sf::Vertex&    c,
-                                   const sf::Transform& transform,
-                                   const sf::Texture*   texture,
-                                   float                level)
+    void SpriteBatch::WriteRun(const RunInfo& run, const sf::Vertex* vertices)
     {
-        m_triangles.emplace_back(texture, level);
+        sf::Vertex* destination = m_unsortedVertices.data() + run.firstVertex;
+
+        // Indexed geometry and triangle lists are stored as submitted
+        if (m_geometry == Geometry::Indexed || run.type == sf::PrimitiveType::Triangles)
+        {
+            VertexTransform::Transform(run.transform, vertices, destination, run.storedVertexCount);
+            return;
+        }
+
+        // Transform the whole run once, then split into triangles
+        m_transformedVertices.resize(run.vertexCount);
+        VertexTransform::Transform(run.transform, vertices, m_transformedVertices.data(), run.vertexCount);
 
-        m_unsortedVertices.push_back({transform * a.position, a.color, a.texCoords});
-        m_unsortedVertices.push_back({transform * b.position, b.color, b.texCoords});
-        m_unsortedVertices.push_back({transform * c.position, c.color, c.texCoords});
+        const auto& transformed = m_transformedVertices;
+        for (std::size_t i = 2; i < run.vertexCount; i++)
+        {
+            *destination++ = run.type == sf::PrimitiveType::TriangleFan ? transformed[0] : transformed[i - 2];
+            *destination++ = transformed[i - 1];
+            *destination++ = transformed[i];
+        }
     }
 
     ////////////////////////////////////////////////////////////
-    bool SpriteBatch::IsStructureChanged() const
+    std::uint32_t SpriteBatch::FindState(const sf::RenderStates& states)
     {
-        if (m_triangles.size() != m_flushedTriangles.size())
-            return true;
+        const StateInfo state(states.texture, states.blendMode, states.shader);
+        if (m_lastState < m_states.size() && m_states[m_lastState] == state)
+            return m_lastState;
+
+        // Render states are numbered in order of first appearance
+        const auto [it, inserted] = m_stateIds.try_emplace(state, static_cast<std::uint32_t>(m_states.size()));
+        if (inserted)
+            m_states.push_back(state);
 
-        return !std::equal(m_triangles.begin(), m_triangles.end(), m_flushedTriangles.begin(),
-                           [](const TriangleInfo& a, const TriangleInfo& b)
-                           { return a.texture == b.texture && a.level == b.level; });
+        m_lastState = it->second;
+        return m_lastState;
     }
 
     ////////////////////////////////////////////////////////////
-    void SpriteBatch::RebuildBatch() const
+    void SpriteBatch::TruncateRuns(const std::size_t runCount)
     {
-        m_batches.clear();
-        m_order.resize(m_triangles.size());
-        std::iota(m_order.begin(), m_order.end(), 0);
+        if (runCount >= m_runs.size())
+            return;
+
+        const auto& run = m_runs[runCount];
+        m_triangles.resize(run.firstTriangle);
+        m_unsortedVertices.resize(run.firstVertex);
+        if (m_geometry == Geometry::Indexed)
+            m_unsortedIndices.resize(run.firstTriangle * 3);
 
-        if (m_batchMode == Mode::TextureSort)
+        m_runs.resize(runCount);
+        m_dirtyRuns.erase(std::remove_if(m_dirtyRuns.begin(), m_dirtyRuns.end(),
+                                         [runCount](const std::size_t index) { return index >= runCount; }),
+                          m_dirtyRuns.end());
+
+        m_structureChanged = true;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::CompactStates()
+    {
+        // Renumber the states in order of first appearance among the live runs
+        m_stateRemap.assign(m_states.size(), UnassignedIndex);
+        std::uint32_t liveCount = 0;
+        for (const auto& run : m_runs)
         {
-            const auto comp = [this](const std::size_t a, const std::size_t b)
-            { return m_triangles[a].texture < m_triangles[b].texture; };
+            if (auto& index = m_stateRemap[run.state]; index == UnassignedIndex)
+                index = liveCount++;
+        }
 
-            std::stable_sort(m_order.begin(), m_order.end(), comp);
+        if (liveCount == m_states.size())
+            return;
+
+        std::vector<StateInfo> states(liveCount);
+        for (std::size_t i = 0; i < m_states.size(); i++)
+        {
+            if (const std::uint32_t index = m_stateRemap[i]; index != UnassignedIndex)
+                states[index] = m_states[i];
         }
-        else if (m_batchMode == Mode::LayerSort)
+
+        for (auto& run : m_runs)
+            run.state = m_stateRemap[run.state];
+
+        for (auto& triangle : m_triangles)
+            triangle.state = m_stateRemap[triangle.state];
+
+        m_states = std::move(states);
+        m_stateIds.clear();
+        for (std::uint32_t i = 0; i < liveCount; i++)
+            m_stateIds.emplace(m_states[i], i);
+
+        m_lastState = 0;
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::RebuildBatch() const
+    {
+        m_batches.clear();
+        m_order.clear();
+
+        // Triangles of culled runs keep their place in the batch, but are neither sorted nor prepared
+        for (const auto& run : m_runs)
         {
-            const auto comp = [this](const std::size_t a, const std::size_t b)
-            {
-                if (m_triangles[a].level != m_triangles[b].level)
-                    return m_triangles[a].level < m_triangles[b].level;
-                else
-                    return m_triangles[a].texture < m_triangles[b].texture;
-            };
+            if (run.culled)
+                continue;
 
-            std::stable_sort(m_order.begin(), m_order.end(), comp);
+            const std::size_t first = m_order.size();
+            m_order.resize(first + run.triangleCount);
+            std::iota(m_order.begin() + static_cast<std::ptrdiff_t>(first), m_order.end(), run.firstTriangle);
         }
 
-        if (!m_span || m_span->size() < m_unsortedVertices.size())
+        if (m_batchMode != Mode::Deferred && !m_order.empty())
+            SortTriangles();
+
+        if (m_geometry == Geometry::Indexed)
         {
-            if (m_span)
-                m_pool.Return(*m_span);
+            // The prepared vertices never outnumber the batched ones, which decides whether 16-bit indices fit
+            const bool shortIndices = m_indexFormat == IndexFormat::UInt16 &&
+                                      m_unsortedVertices.size() <= std::numeric_limits<std::uint16_t>::max() + std::size_t(1);
 
-            m_span.emplace(m_pool.Rent(m_unsortedVertices.size()));
-        }
+            m_preparedIndexFormat = shortIndices ? IndexFormat::UInt16 : IndexFormat::UInt32;
+            m_indices.resize(shortIndices ? 0 : m_order.size() * 3);
+            m_shortIndices.resize(shortIndices ? m_order.size() * 3 : 0);
 
-        for (std::size_t i = 0; i < m_order.size(); i++)
+            // Gather the referenced vertices in draw order and remap the indices onto them
+            m_remap.assign(m_unsortedVertices.size(), UnassignedIndex);
+            m_vertexOrder.clear();
+
+            for (std::size_t i = 0; i < m_order.size(); i++)
+            {
+                for (std::size_t j = 0; j < 3; j++)
+                {
+                    const std::uint32_t oldIndex = m_unsortedIndices[m_order[i] * 3 + j];
+                    if (m_remap[oldIndex] == UnassignedIndex)
+                    {
+                        m_remap[oldIndex] = static_cast<std::uint32_t>(m_vertexOrder.size());
+                        m_vertexOrder.push_back(oldIndex);
+                    }
+
+                    if (shortIndices)
+                        m_shortIndices[i * 3 + j] = static_cast<std::uint16_t>(m_remap[oldIndex]);
+                    else
+                        m_indices[i * 3 + j] = m_remap[oldIndex];
+                }
+            }
+
+            ReserveSpan(m_vertexOrder.size());
+            for (std::size_t i = 0; i < m_vertexOrder.size(); i++)
+                (*m_span)[i] = m_unsortedVertices[m_vertexOrder[i]];
+        }
+        else
         {
-            const std::size_t newPos = i * 3;
-            const std::size_t oldPos = m_order[i] * 3;
-            (*m_span)[newPos]     = m_unsortedVertices[oldPos];
-            (*m_span)[newPos + 1] = m_unsortedVertices[oldPos + 1];
-            (*m_span)[newPos + 2] = m_unsortedVertices[oldPos + 2];
+            ReserveSpan(m_order.size() * 3);
+            m_inverseOrder.resize(m_triangles.size());
+            for (std::size_t i = 0; i < m_order.size(); i++)
+            {
+                m_inverseOrder[m_order[i]] = i;
+
+                const std::size_t newPos = i * 3;
+                const std::size_t oldPos = m_order[i] * 3;
+                (*m_span)[newPos]     = m_unsortedVertices[oldPos];
+                (*m_span)[newPos + 1] = m_unsortedVertices[oldPos + 1];
+                (*m_span)[newPos + 2] = m_unsortedVertices[oldPos + 2];
+            }
         }
 
+        // Break batches wherever the render state changes
         std::size_t startIndex = 0;
-        const sf::Texture* lastTexture = m_order.empty() ? nullptr : m_triangles[m_order[0]].texture;
+        std::uint32_t lastState = m_order.empty() ? 0 : m_triangles[m_order[0]].state;
 
         for (std::size_t i = 1; i < m_order.size(); i++)
         {
-            if (const sf::Texture* nextTexture = m_triangles[m_order[i]].texture; nextTexture != lastTexture)
+            if (const std::uint32_t nextState = m_triangles[m_order[i]].state; nextState != lastState)
             {
-                m_batches.emplace_back(lastTexture, (i - startIndex) * 3);
-                lastTexture = nextTexture;
-                startIndex  = i;
+                m_batches.emplace_back(m_states[lastState], (i - startIndex) * 3);
+                lastState  = nextState;
+                startIndex = i;
             }
         }
 
         if (startIndex != m_order.size())
-            m_batches.emplace_back(lastTexture, (m_order.size() - startIndex) * 3);
+            m_batches.emplace_back(m_states[lastState], (m_order.size() - startIndex) * 3);
     }
 
     ////////////////////////////////////////////////////////////
-    void SpriteBatch::RewriteVertices() const
+    void SpriteBatch::SortTriangles() const
     {
+        // Render states are ranked in order of first appearance within the batch
+        m_stateRanks.assign(m_states.size(), UnassignedIndex);
+        std::uint32_t nextRank = 0;
+
+        m_sortKeys.resize(m_order.size());
         for (std::size_t i = 0; i < m_order.size(); i++)
         {
-            const std::size_t oldPos = m_order[i] * 3;
-            const std::size_t newPos = i * 3;
-            if (std::memcmp(&m_unsortedVertices[oldPos], m_span->data() + newPos, sizeof(sf::Vertex) * 3) == 0)
+            const auto& triangle = m_triangles[m_order[i]];
+            auto&       rank     = m_stateRanks[triangle.state];
+            if (rank == UnassignedIndex)
+                rank = nextRank++;
+
+            // Layer in the upper half, render state in the lower half, submission order is kept by the stable sort
+            std::uint64_t key = rank;
+            if (m_batchMode == Mode::LayerSort)
+                key |= static_cast<std::uint64_t>(ToOrderedBits(triangle.level)) << 32;
+
+            m_sortKeys[i] = key;
+        }
+
+        RadixSort(m_sortKeys, m_order, m_sortKeysBuffer, m_sortOrderBuffer);
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::RewriteVertices() const
+    {
+        m_dirtyRanges.clear();
+
+        // Extend the previous range when the rewritten vertices are adjacent
+        const auto markDirty = [this](const std::size_t offset, const std::size_t size)
+        {
+            if (!m_dirtyRanges.empty() && m_dirtyRanges.back().first + m_dirtyRanges.back().second == offset)
+                m_dirtyRanges.back().second += size;
+            else
+                m_dirtyRanges.emplace_back(offset, size);
+        };
+
+        for (const std::size_t runIndex : m_dirtyRuns)
+        {
+            const auto& run = m_runs[runIndex];
+            if (run.culled)
+                continue;
+
+            if (m_geometry == Geometry::Indexed)
+            {
+                for (std::size_t i = run.firstVertex; i < run.firstVertex + run.storedVertexCount; i++)
+                {
+                    if (const std::uint32_t newPos = m_remap[i]; newPos != UnassignedIndex)
+                    {
+                        (*m_span)[newPos] = m_unsortedVertices[i];
+                        markDirty(newPos, 1);
+                    }
+                }
+
                 continue;
+            }
 
-            (*m_span)[newPos]     = m_unsortedVertices[oldPos];
-            (*m_span)[newPos + 1] = m_unsortedVertices[oldPos + 1];
-            (*m_span)[newPos + 2] = m_unsortedVertices[oldPos + 2];
+            for (std::size_t i = run.firstTriangle; i < run.firstTriangle + run.triangleCount; i++)
+            {
+                const std::size_t oldPos = i * 3;
+                const std::size_t newPos = m_inverseOrder[i] * 3;
+                if (std::memcmp(&m_unsortedVertices[oldPos], m_span->data() + newPos, sizeof(sf::Vertex) * 3) == 0)
+                    continue;
+
+                (*m_span)[newPos]     = m_unsortedVertices[oldPos];
+                (*m_span)[newPos + 1] = m_unsortedVertices[oldPos + 1];
+                (*m_span)[newPos + 2] = m_unsortedVertices[oldPos + 2];
+                markDirty(newPos, 3);
+            }
         }
     }
 
     ////////////////////////////////////////////////////////////
-    void SpriteBatch::Flush()
+    void SpriteBatch::ReserveSpan(const std::size_t size) const
     {
-        std::swap(m_flushedTriangles, m_triangles);
+        if (!m_span || m_span->size() < size)
+        {
+            if (m_span)
+                m_pool.Return(*m_span);
 
-        m_triangles.clear();
-        m_unsortedVertices.clear();
+            m_span.emplace(m_pool.Rent(size));
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::UploadBatch(RenderSurface& surface, bool full) const
+    {
+        if (!m_storage)
+            m_storage = std::make_unique<VertexBufferAdaptor>();
+
+        const std::size_t vertexCount = GetPreparedVertexCount();
+        if (m_storage->GetVertexCount() < vertexCount)
+        {
+            if (!m_storage->Create(m_span->size()))
+                throw NotSupportedException("Failed to create vertex buffer for static batch");
+
+            full = true;
+        }
+
+        if (full)
+        {
+            if (vertexCount > 0)
+            {
+                m_storage->Update(m_span->data(), vertexCount, 0);
+                surface.NotifyUpload(vertexCount);
+            }
+        }
+        else
+        {
+            for (const auto& [offset, size] : m_dirtyRanges)
+            {
+                m_storage->Update(m_span->data() + offset, size, offset);
+                surface.NotifyUpload(size);
+            }
+        }
+
+        m_dirtyRanges.clear();
+    }
+
+    ////////////////////////////////////////////////////////////
+    void SpriteBatch::Flush()
+    {
+        // Batched data is kept, so the next submissions can be diffed against it
+        m_runCursor         = 0;
+        m_structureChanged  = false;
+        m_visibilityChanged = false;
+        m_dirtyRuns.clear();
+
+        m_lastCulledCount = m_culledCount;
+        m_lastDrawnCount  = m_drawnCount;
+        m_culledCount     = 0;
+        m_drawnCount      = 0;
     }
 
     ////////////////////////////////////////////////////////////
     void SpriteBatch::ClearBatch()
     {
         m_unsortedVertices.clear();
+        m_unsortedIndices.clear();
         m_triangles.clear();
-        m_flushedTriangles.clear();
+        m_runs.clear();
+        m_dirtyRuns.clear();
+        m_states.clear();
+        m_stateIds.clear();
         m_order.clear();
+        m_inverseOrder.clear();
+        m_vertexOrder.clear();
+        m_indices.clear();
+        m_shortIndices.clear();
         m_batches.clear();
+        m_dirtyRanges.clear();
 
+        m_runCursor       = 0;
         m_rebuildRequired = true;
+        m_uploaded        = false;
     }
 
 } // namespace Gx
@@ -0,0 +1,163 @@
+#include <Genode/Graphics/TextureAtlas.hpp>
+#include <Genode/System/Exception.hpp>
+
+#include <algorithm>
+
+namespace Gx
+{
+    TextureAtlas::TextureAtlas(const sf::Vector2u& pageSize, const unsigned int padding) :
+        m_pageSize(pageSize),
+        m_padding(padding),
+        m_smooth(true),
+        m_staged(),
+        m_pages(),
+        m_regions(),
+        m_usedArea(0)
+    {
+        if (pageSize.x == 0 || pageSize.y == 0)
+            throw ArgumentException("pageSize", "Page size must not be empty");
+    }
+
+    void TextureAtlas::Add(const std::string& id, const sf::Image& image)
+    {
+        if (m_regions.find(id) != m_regions.end())
+            throw InvalidOperationException("Texture atlas already contains region: " + id);
+
+        auto it = std::find_if(m_staged.begin(), m_staged.end(), [&id] (const StagedImage& staged) { return staged.Id == id; });
+        if (it != m_staged.end())
+            it->Image = image;
+        else
+            m_staged.push_back({id, image});
+    }
+
+    void TextureAtlas::Build()
+    {
+        if (m_staged.empty())
+            return;
+
+        auto sizes = std::vector<sf::Vector2u>();
+        sizes.reserve(m_staged.size());
+        for (const auto& staged : m_staged)
+            sizes.push_back(staged.Image.getSize());
+
+        auto packer     = TexturePacker(m_pageSize, m_padding);
+        auto placements = packer.Pack(sizes);
+
+        // Pages are trimmed to their packed extent, so a small final page does not cost a full page of memory
+        auto images = std::vector<sf::Image>();
+        images.reserve(packer.GetPageCount());
+        for (std::size_t page = 0; page < packer.GetPageCount(); ++page)
+        {
+            auto extent = packer.GetPageExtent(page);
+            images.emplace_back(sf::Vector2u(std::max(extent.x, 1u), std::max(extent.y, 1u)), sf::Color::Transparent);
+        }
+
+        for (std::size_t i = 0; i < m_staged.size(); ++i)
+        {
+            const auto& image = m_staged[i].Image;
+            if (image.getSize().x > 0 && image.getSize().y > 0)
+            {
+                if (!images[placements[i].Page].copy(image, placements[i].Position))
+                    throw Exception("Failed to copy image into texture atlas: " + m_staged[i].Id);
+            }
+        }
+
+        auto firstPage = m_pages.size();
+        for (const auto& image : images)
+        {
+            auto texture = std::make_unique<sf::Texture>();
+            if (!texture->loadFromImage(image))
+                throw Exception("Failed to create texture atlas page");
+
+            texture->setSmooth(m_smooth);
+            m_pages.push_back(std::move(texture));
+        }
+
+        for (std::size_t i = 0; i < m_staged.size(); ++i)
+        {
+            const auto& placement = placements[i];
+            m_regions[m_staged[i].Id] = TextureRegion{
+                m_pages[firstPage + placement.Page].get(),
+                sf::IntRect(sf::Vector2i(placement.Position), sf::Vector2i(m_staged[i].Image.getSize()))
+            };
+
+            m_usedArea += static_cast<std::size_t>(m_staged[i].Image.getSize().x) * m_staged[i].Image.getSize().y;
+        }
+
+        m_staged.clear();
+    }
+
+    void TextureAtlas::Clear()
+    {
+        m_staged.clear();
+        m_regions.clear();
+        m_pages.clear();
+        m_usedArea = 0;
+    }
+
+    bool TextureAtlas::Contains(const std::string& id) const
+    {
+        return m_regions.find(id) != m_regions.end();
+    }
+
+    const TextureRegion* TextureAtlas::Find(const std::string& id) const
+    {
+        auto it = m_regions.find(id);
+        return it != m_regions.end() ? &it->second : nullptr;
+    }
+
+    const TextureRegion& TextureAtlas::GetRegion(const std::string& id) const
+    {
+        if (auto region = Find(id))
+            return *region;
+
+        throw ArgumentException("id", "Texture atlas does not contain region: " + id);
+    }
+
+    std::size_t TextureAtlas::GetPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    const sf::Texture& TextureAtlas::GetPage(const std::size_t index) const
+    {
+        if (index >= m_pages.size())
+            throw ArgumentOutOfRangeException("index", "Page index is out of range");
+
+        return *m_pages[index];
+    }
+
+    float TextureAtlas::GetOccupancy() const
+    {
+        if (m_pages.empty())
+            return 0.f;
+
+        auto allocated = 0.0;
+        for (const auto& page : m_pages)
+            allocated += static_cast<double>(page->getSize().x) * static_cast<double>(page->getSize().y);
+
+        return static_cast<float>(static_cast<double>(m_usedArea) / allocated);
+    }
+
+    const sf::Vector2u& TextureAtlas::GetPageSize() const
+    {
+        return m_pageSize;
+    }
+
+    unsigned int TextureAtlas::GetPadding() const
+    {
+        return m_padding;
+    }
+
+    bool TextureAtlas::IsSmooth() const
+    {
+        return m_smooth;
+    }
+
+    void TextureAtlas::SetSmooth(const bool smooth)
+    {
+        m_smooth = smooth;
+        for (auto& page : m_pages)
+            page->setSmooth(smooth);
+    }
+}
@@ -0,0 +1,182 @@
+#include <Genode/Graphics/TexturePacker.hpp>
+#include <Genode/System/Exception.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+namespace Gx
+{
+    TexturePacker::TexturePacker(const sf::Vector2u& pageSize, const unsigned int padding) :
+        m_pageSize(pageSize),
+        m_padding(padding),
+        m_pages(),
+        m_usedArea(0)
+    {
+        if (pageSize.x == 0 || pageSize.y == 0)
+            throw ArgumentException("pageSize", "Page size must not be empty");
+    }
+
+    const sf::Vector2u& TexturePacker::GetPageSize() const
+    {
+        return m_pageSize;
+    }
+
+    unsigned int TexturePacker::GetPadding() const
+    {
+        return m_padding;
+    }
+
+    std::size_t TexturePacker::GetPageCount() const
+    {
+        return m_pages.size();
+    }
+
+    sf::Vector2u TexturePacker::GetPageExtent(const std::size_t page) const
+    {
+        if (page >= m_pages.size())
+            throw ArgumentOutOfRangeException("page", "Page index is out of range");
+
+        return m_pages[page].Extent;
+    }
+
+    float TexturePacker::GetOccupancy() const
+    {
+        if (m_pages.empty())
+            return 0.f;
+
+        auto pageArea = static_cast<double>(m_pageSize.x) * static_cast<double>(m_pageSize.y);
+        return static_cast<float>(static_cast<double>(m_usedArea) / (pageArea * static_cast<double>(m_pages.size())));
+    }
+
+    std::vector<TexturePacker::Placement> TexturePacker::Pack(const std::vector<sf::Vector2u>& sizes)
+    {
+        m_pages.clear();
+        m_usedArea = 0;
+
+        auto placements = std::vector<Placement>(sizes.size());
+        if (sizes.empty())
+            return placements;
+
+        // Tallest first keeps the skyline flat; the index tie-break makes the order total and thus deterministic
+        auto order = std::vector<std::size_t>(sizes.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&sizes] (const std::size_t a, const std::size_t b)
+        {
+            if (sizes[a].y != sizes[b].y)
+                return sizes[a].y > sizes[b].y;
+            if (sizes[a].x != sizes[b].x)
+                return sizes[a].x > sizes[b].x;
+
+            return a < b;
+        });
+
+        for (const auto index : order)
+        {
+            const auto& size = sizes[index];
+            if (size.x > m_pageSize.x || size.y > m_pageSize.y)
+                throw ArgumentException("sizes", "Texture size exceeds the atlas page size");
+
+            auto& placement = placements[index];
+            if (size.x == 0 || size.y == 0)
+                continue;
+
+            bool inserted = false;
+            for (std::size_t page = 0; page < m_pages.size() && !inserted; ++page)
+            {
+                if (Insert(m_pages[page], size, placement.Position))
+                {
+                    placement.Page = page;
+                    inserted       = true;
+                }
+            }
+
+            if (!inserted)
+            {
+                auto& page = m_pages.emplace_back();
+                page.Skyline.push_back({0, 0, m_pageSize.x});
+
+                Insert(page, size, placement.Position);
+                placement.Page = m_pages.size() - 1;
+            }
+
+            m_usedArea += static_cast<std::size_t>(size.x) * size.y;
+        }
+
+        // Empty textures share the origin of the first page
+        if (m_pages.empty())
+            m_pages.emplace_back().Skyline.push_back({0, 0, m_pageSize.x});
+
+        return placements;
+    }
+
+    bool TexturePacker::Insert(Page& page, const sf::Vector2u& size, sf::Vector2u& position) const
+    {
+        auto& skyline  = page.Skyline;
+        auto bestIndex = skyline.size();
+        auto bestY     = std::numeric_limits<unsigned int>::max();
+
+        // Bottom-left rule: lowest resting height wins, leftmost on ties
+        for (std::size_t i = 0; i < skyline.size(); ++i)
+        {
+            auto x = skyline[i].X;
+            if (x + size.x > m_pageSize.x)
+                break;
+
+            // The padding gutter is claimed as well, so it has to rest on the skyline too
+            auto right = x + std::min(size.x + m_padding, m_pageSize.x - x);
+            auto y     = 0u;
+            for (std::size_t j = i; j < skyline.size() && skyline[j].X < right; ++j)
+                y = std::max(y, skyline[j].Y);
+
+            if (y + size.y <= m_pageSize.y && y < bestY)
+            {
+                bestIndex = i;
+                bestY     = y;
+            }
+        }
+
+        if (bestIndex == skyline.size())
+            return false;
+
+        auto x     = skyline[bestIndex].X;
+        auto width = std::min(size.x + m_padding, m_pageSize.x - x);
+        auto right = x + width;
+
+        skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(bestIndex), {x, bestY + size.y + m_padding, width});
+        for (auto i = bestIndex + 1; i < skyline.size();)
+        {
+            auto& node = skyline[i];
+            if (node.X >= right)
+                break;
+
+            auto overlap = right - node.X;
+            if (node.Width <= overlap)
+            {
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i));
+                continue;
+            }
+
+            node.X     += overlap;
+            node.Width -= overlap;
+            break;
+        }
+
+        for (std::size_t i = 0; i + 1 < skyline.size();)
+        {
+            if (skyline[i].Y == skyline[i + 1].Y)
+            {
+                skyline[i].Width += skyline[i + 1].Width;
+                skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+            }
+            else
+                ++i;
+        }
+
+        position      = {x, bestY};
+        page.Extent.x = std::max(page.Extent.x, x + size.x);
+        page.Extent.y = std::max(page.Extent.y, bestY + size.y);
+
+        return true;
+    }
+}
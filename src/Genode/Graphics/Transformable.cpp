@@ -47,6 +47,8 @@ namespace Gx
         m_position                   = position;
         m_transformNeedUpdate        = true;
         m_inverseTransformNeedUpdate = true;
+
+        OnTransformChanged();
     }
 
 
@@ -67,6 +69,8 @@ namespace Gx
         m_rotation                   = rotation;
         m_transformNeedUpdate        = true;
         m_inverseTransformNeedUpdate = true;
+
+        OnTransformChanged();
     }
 
 
@@ -86,6 +90,8 @@ namespace Gx
         m_scale                      = factors;
         m_transformNeedUpdate        = true;
         m_inverseTransformNeedUpdate = true;
+
+        OnTransformChanged();
     }
 
 
@@ -105,6 +111,8 @@ namespace Gx
         m_origin                     = origin;
         m_transformNeedUpdate        = true;
         m_inverseTransformNeedUpdate = true;
+
+        OnTransformChanged();
     }
 
 
@@ -178,6 +186,12 @@ namespace Gx
     }
 
 
+    ////////////////////////////////////////////////////////////
+    void Transformable::OnTransformChanged()
+    {
+    }
+
+
     ////////////////////////////////////////////////////////////
     const sf::Transform& Transformable::GetTransform() const
     {
@@ -0,0 +1,34 @@
+#include <Genode/Graphics/VertexBufferAdaptor.hpp>
+
+namespace Gx
+{
+    VertexBufferAdaptor::VertexBufferAdaptor(const sf::PrimitiveType primitiveType, const sf::VertexBuffer::Usage usage) :
+        m_buffer(primitiveType, usage)
+    {
+    }
+
+    std::size_t VertexBufferAdaptor::GetVertexCount() const
+    {
+        return m_buffer.getVertexCount();
+    }
+
+    bool VertexBufferAdaptor::Create(const std::size_t vertexCount)
+    {
+        return m_buffer.create(vertexCount);
+    }
+
+    bool VertexBufferAdaptor::Update(const sf::Vertex* vertices, const std::size_t vertexCount, const std::size_t offset)
+    {
+        return m_buffer.update(vertices, vertexCount, static_cast<unsigned int>(offset));
+    }
+
+    void VertexBufferAdaptor::Render(RenderSurface& surface, const std::size_t firstVertex, const std::size_t vertexCount, const RenderStates& states) const
+    {
+        surface.Render(m_buffer, firstVertex, vertexCount, states);
+    }
+
+    const sf::VertexBuffer& VertexBufferAdaptor::GetVertexBuffer() const
+    {
+        return m_buffer;
+    }
+}
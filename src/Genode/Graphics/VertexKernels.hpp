@@ -0,0 +1,23 @@
+#pragma once
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define GENODE_VERTEX_SSE2
+
+    // The AVX2 kernel lives in VertexTransformAVX2.cpp, the only file compiled for AVX2 (through a target attribute
+    // on GCC and Clang, through /arch:AVX2 on MSVC), so the other kernels stay runnable on any SSE2 processor
+    #if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+        #define GENODE_VERTEX_AVX2
+    #endif
+#endif
+
+namespace Gx
+{
+#if defined(GENODE_VERTEX_AVX2)
+    // Transforms the positions of the leading vertices four at a time and returns how many were transformed
+    std::size_t TransformAVX2(const float* matrix, sf::Vertex* vertices, std::size_t count);
+#endif
+}
@@ -2,6 +2,35 @@
 #include <algorithm>
 #include <cassert>
 
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace
+{
+    std::size_t HighestBit(const std::uint64_t value)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return index;
+    #else
+        return 63 - static_cast<std::size_t>(__builtin_clzll(value));
+    #endif
+    }
+
+    std::size_t LowestBit(const std::uint64_t value)
+    {
+    #if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return index;
+    #else
+        return static_cast<std::size_t>(__builtin_ctzll(value));
+    #endif
+    }
+}
+
 namespace Gx
 {
     VertexPool::VertexPool(const sf::PrimitiveType primitiveType) :
@@ -12,7 +41,7 @@ namespace Gx
     VertexPool::VertexPool(std::size_t capacity)
     {
         m_vertices.reserve(capacity);
-        m_segments.emplace_back(0, capacity, false);
+        ResetBlocks(capacity);
     }
 
     VertexPool::VertexPool(const sf::PrimitiveType primitiveType, const std::size_t capacity) :
@@ -21,13 +50,6 @@ namespace Gx
         m_primitive = primitiveType;
     }
 
-    VertexPool::Segment::Segment(const std::size_t offset, const std::size_t size, const bool inUse) :
-        m_offset(offset),
-        m_size(size),
-        m_inUse(inUse)
-    {
-    }
-
     VertexSpan VertexPool::Rent(const std::size_t size)
     {
         return Rent(size, false);
@@ -37,64 +59,61 @@ namespace Gx
     {
         if (size == 0)
         {
-            return { *this, 0, size, scoped };
+            return { *this, InvalidBlock, 0, size, scoped };
         }
 
-        const auto segmentIdx = Scan(size);
-        if (!segmentIdx)
-        {
-            std::size_t newOffset = m_vertices.size();
-            m_vertices.resize(newOffset + size);
-            m_segments.emplace_back(newOffset, size, true);
-
-            return { *this, newOffset, size, scoped };
-        }
+        auto block = FindFree(size);
+        if (block != InvalidBlock)
+            UnlinkFree(block);
+        else
+            block = Grow(size);
 
-        const auto offset = m_segments[*segmentIdx].m_offset;
-        if (m_segments[*segmentIdx].m_size > size)
-        {
-            m_segments.insert(
-                m_segments.begin() + static_cast<VertexSpan::difference_type>(*segmentIdx) + 1,
-                Segment(offset + size, m_segments[*segmentIdx].m_size - size, false)
-            );
+        Split(block, size);
+        m_blocks[block].m_inUse = true;
 
-            m_segments[*segmentIdx].m_size = size;
-        }
-
-        m_segments[*segmentIdx].m_inUse = true;
+        const auto offset = m_blocks[block].m_offset;
         if (m_vertices.size() < offset + size)
             m_vertices.resize(offset + size);
 
-        return { *this, offset, size, scoped };
+        return { *this, block, offset, size, scoped };
     }
 
     void VertexPool::Return(VertexSpan& span)
     {
-        std::size_t offset = span.offset();
-        std::size_t size   = span.size();
+        // Spans that are empty, already returned or outlived a Reset do not own their block anymore
+        const auto block = span.m_block;
+        if (block >= m_blocks.size() || !m_blocks[block].m_inUse ||
+            m_blocks[block].m_offset != span.offset() || m_blocks[block].m_size != span.size())
+        {
+            return;
+        }
 
         // Clear the vertices in the span and invalidate it
         std::fill(span.begin(), span.end(), sf::Vertex{ {}, sf::Color::Transparent, {} });
+        m_blocks[block].m_inUse = false;
 
-        // Find and mark the segment as unused
-        const auto it = std::find_if(m_segments.begin(), m_segments.end(), [offset, size] (const Segment& s)
+        // Coalesce with the free neighbors, so the free lists never hold adjacent blocks
+        auto merged = block;
+        if (const auto next = m_blocks[merged].m_next; next != InvalidBlock && !m_blocks[next].m_inUse)
         {
-            return s.m_offset == offset && s.m_size == size;
-        });
+            UnlinkFree(next);
+            merged = Merge(merged, next);
+        }
 
-        // Merge free segments into one
-        if (it != m_segments.end())
+        if (const auto prev = m_blocks[merged].m_prev; prev != InvalidBlock && !m_blocks[prev].m_inUse)
         {
-            it->m_inUse = false;
-            Defragment();
+            UnlinkFree(prev);
+            merged = Merge(prev, merged);
         }
+
+        LinkFree(merged);
     }
 
     VertexSpan VertexPool::Transfer(const std::vector<sf::Vertex>& vertices)
     {
         if (vertices.empty())
         {
-            return { *this, 0, 0 };
+            return { *this, InvalidBlock, 0, 0 };
         }
 
         VertexSpan span = Rent(vertices.size());
@@ -107,7 +126,7 @@ namespace Gx
         const auto count = vertices.getVertexCount();
         if (count == 0)
         {
-            return { *this, 0, 0 };
+            return { *this, InvalidBlock, 0, 0 };
         }
 
         VertexSpan span = Rent(count);
@@ -122,15 +141,13 @@ namespace Gx
     void VertexPool::Reset()
     {
         std::fill(m_vertices.begin(), m_vertices.end(), sf::Vertex{ {}, sf::Color::Transparent, {} });
-        m_segments.clear();
-        m_segments.emplace_back(0, m_vertices.size(), false);
+        ResetBlocks(m_vertices.size());
     }
 
     void VertexPool::Clear()
     {
         m_vertices.clear();
-        m_segments.clear();
-        m_segments.emplace_back(0, m_vertices.size(), false);
+        ResetBlocks(0);
     }
 
     std::size_t VertexPool::GetCapacity() const noexcept
@@ -169,54 +186,155 @@ namespace Gx
         return states;
     }
 
-    std::optional<std::size_t> VertexPool::Scan(const std::size_t size) const
+    std::size_t VertexPool::FindFree(const std::size_t size) const
     {
-        for (std::size_t i = 0; i < m_segments.size(); ++i)
+        // Every block of a higher class fits, and so does every block of the own class when the size is a power of two
+        const auto sizeClass  = HighestBit(size);
+        const auto firstClass = (size & (size - 1)) == 0 ? sizeClass : sizeClass + 1;
+        if (firstClass < SizeClassCount)
         {
-            if (!m_segments[i].m_inUse && m_segments[i].m_size >= size)
+            if (const auto classes = m_freeClasses & (~std::uint64_t{0} << firstClass))
+                return m_freeLists[LowestBit(classes)];
+        }
+
+        // Otherwise only a block of the own class might still be large enough
+        if (m_freeClasses & (std::uint64_t{1} << sizeClass))
+        {
+            for (auto block = m_freeLists[sizeClass]; block != InvalidBlock; block = m_blocks[block].m_nextFree)
             {
-                return i;
+                if (m_blocks[block].m_size >= size)
+                    return block;
             }
         }
 
-        return std::nullopt;
+        return InvalidBlock;
     }
 
-    void VertexPool::Defragment()
+    std::size_t VertexPool::Grow(const std::size_t size)
     {
-        if (m_segments.empty())
+        // A free block at the end is extended in place instead of leaving it behind as a fragment
+        if (m_lastBlock != InvalidBlock && !m_blocks[m_lastBlock].m_inUse)
         {
-            return;
+            UnlinkFree(m_lastBlock);
+            m_blocks[m_lastBlock].m_size = size;
+
+            return m_lastBlock;
         }
 
-        std::vector<Segment> newSegments;
-        newSegments.push_back(m_segments[0]);
+        const auto offset = m_lastBlock != InvalidBlock ? m_blocks[m_lastBlock].m_offset + m_blocks[m_lastBlock].m_size : 0;
+        return CreateBlock(offset, size, m_lastBlock, InvalidBlock);
+    }
 
-        for (std::size_t i = 1; i < m_segments.size(); ++i)
-        {
-            Segment& last = newSegments.back();
-            Segment& current = m_segments[i];
+    void VertexPool::Split(const std::size_t block, const std::size_t size)
+    {
+        if (m_blocks[block].m_size <= size)
+            return;
 
-            if (!last.m_inUse && !current.m_inUse &&
-                last.m_offset + last.m_size == current.m_offset)
-            {
-                // Merge segments
-                last.m_size += current.m_size;
-            }
-            else
-            {
-                newSegments.push_back(current);
-            }
+        const auto offset    = m_blocks[block].m_offset + size;
+        const auto remainder = m_blocks[block].m_size - size;
+        const auto rest      = CreateBlock(offset, remainder, block, m_blocks[block].m_next);
+
+        m_blocks[block].m_size = size;
+        LinkFree(rest);
+    }
+
+    std::size_t VertexPool::Merge(const std::size_t block, const std::size_t next)
+    {
+        m_blocks[block].m_size += m_blocks[next].m_size;
+        m_blocks[block].m_next  = m_blocks[next].m_next;
+
+        if (m_blocks[block].m_next != InvalidBlock)
+            m_blocks[m_blocks[block].m_next].m_prev = block;
+        else
+            m_lastBlock = block;
+
+        ReleaseBlock(next);
+        return block;
+    }
+
+    std::size_t VertexPool::CreateBlock(const std::size_t offset, const std::size_t size, const std::size_t prev, const std::size_t next)
+    {
+        std::size_t block;
+        if (!m_unused.empty())
+        {
+            block = m_unused.back();
+            m_unused.pop_back();
         }
+        else
+        {
+            block = m_blocks.size();
+            m_blocks.emplace_back();
+        }
+
+        m_blocks[block] = Block{offset, size, prev, next, InvalidBlock, InvalidBlock, false};
+        if (prev != InvalidBlock)
+            m_blocks[prev].m_next = block;
+
+        if (next != InvalidBlock)
+            m_blocks[next].m_prev = block;
+        else
+            m_lastBlock = block;
+
+        return block;
+    }
+
+    void VertexPool::ReleaseBlock(const std::size_t block)
+    {
+        m_blocks[block] = Block{};
+        m_unused.push_back(block);
+    }
+
+    void VertexPool::LinkFree(const std::size_t block)
+    {
+        const auto sizeClass = HighestBit(m_blocks[block].m_size);
+        const auto classBit  = std::uint64_t{1} << sizeClass;
+
+        m_blocks[block].m_prevFree = InvalidBlock;
+        m_blocks[block].m_nextFree = (m_freeClasses & classBit) ? m_freeLists[sizeClass] : InvalidBlock;
+        if (m_blocks[block].m_nextFree != InvalidBlock)
+            m_blocks[m_blocks[block].m_nextFree].m_prevFree = block;
+
+        m_freeLists[sizeClass] = block;
+        m_freeClasses         |= classBit;
+    }
+
+    void VertexPool::UnlinkFree(const std::size_t block)
+    {
+        const auto sizeClass = HighestBit(m_blocks[block].m_size);
+        const auto prev      = m_blocks[block].m_prevFree;
+        const auto next      = m_blocks[block].m_nextFree;
+
+        if (prev != InvalidBlock)
+            m_blocks[prev].m_nextFree = next;
+        else if (next != InvalidBlock)
+            m_freeLists[sizeClass] = next;
+        else
+            m_freeClasses &= ~(std::uint64_t{1} << sizeClass);
+
+        if (next != InvalidBlock)
+            m_blocks[next].m_prevFree = prev;
+
+        m_blocks[block].m_prevFree = InvalidBlock;
+        m_blocks[block].m_nextFree = InvalidBlock;
+    }
+
+    void VertexPool::ResetBlocks(const std::size_t size)
+    {
+        m_blocks.clear();
+        m_unused.clear();
+        m_lastBlock   = InvalidBlock;
+        m_freeClasses = 0;
 
-        m_segments = std::move(newSegments);
+        if (size > 0)
+            LinkFree(CreateBlock(0, size, InvalidBlock, InvalidBlock));
     }
 }
 
 namespace Gx
 {
-    VertexSpan::VertexSpan(VertexPool& pool, const size_type offset, const size_type size, const bool scoped) :
+    VertexSpan::VertexSpan(VertexPool& pool, const size_type block, const size_type offset, const size_type size, const bool scoped) :
         m_pool(&pool),
+        m_block(block),
         m_offset(offset),
         m_size(size),
         m_scoped(scoped)
@@ -225,6 +343,7 @@ namespace Gx
 
     VertexSpan::VertexSpan(VertexSpan&& other) noexcept :
         m_pool(other.m_pool),
+        m_block(other.m_block),
         m_offset(other.m_offset),
         m_size(other.m_size),
         m_scoped(other.m_scoped)
@@ -248,6 +367,7 @@ namespace Gx
             m_pool->Return(*this);
 
         m_pool   = other.m_pool;
+        m_block  = other.m_block;
         m_offset = other.m_offset;
         m_size   = other.m_size;
         m_scoped = other.m_scoped;
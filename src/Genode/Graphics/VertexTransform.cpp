@@ -0,0 +1,168 @@
+#include <Genode/Graphics/VertexTransform.hpp>
+#include <Genode/Graphics/VertexKernels.hpp>
+#include <Genode/System/Exception.hpp>
+
+#include <cstring>
+
+#if defined(GENODE_VERTEX_SSE2)
+    #include <emmintrin.h>
+#endif
+
+#if defined(GENODE_VERTEX_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace Gx
+{
+    namespace
+    {
+        // Same operation order as sf::Transform::transformPoint, so every kernel yields identical results as long as
+        // multiply-adds are not fused (see CMakeLists.txt and checks/VertexTransformCheck.cpp)
+        void TransformScalar(const float* matrix, sf::Vertex* vertices, const std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; i++)
+            {
+                const sf::Vector2f point = vertices[i].position;
+                vertices[i].position = {
+                    matrix[0] * point.x + matrix[4] * point.y + matrix[12],
+                    matrix[1] * point.x + matrix[5] * point.y + matrix[13]
+                };
+            }
+        }
+
+    #if defined(GENODE_VERTEX_SSE2)
+        void TransformSSE2(const float* matrix, sf::Vertex* vertices, const std::size_t count)
+        {
+            const __m128 mx = _mm_setr_ps(matrix[0], matrix[1], matrix[0], matrix[1]);
+            const __m128 my = _mm_setr_ps(matrix[4], matrix[5], matrix[4], matrix[5]);
+            const __m128 mt = _mm_setr_ps(matrix[12], matrix[13], matrix[12], matrix[13]);
+
+            // Two positions per register: [x0 y0 x1 y1]
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2)
+            {
+                auto* a = reinterpret_cast<__m64*>(&vertices[i].position);
+                auto* b = reinterpret_cast<__m64*>(&vertices[i + 1].position);
+
+                const __m128 points = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), a), b);
+                const __m128 xs     = _mm_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+                const __m128 ys     = _mm_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+                const __m128 result = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, mx), _mm_mul_ps(ys, my)), mt);
+
+                _mm_storel_pi(a, result);
+                _mm_storeh_pi(b, result);
+            }
+
+            TransformScalar(matrix, vertices + i, count - i);
+        }
+    #endif
+
+    #if defined(GENODE_VERTEX_AVX2) && defined(_MSC_VER) && !defined(__clang__)
+        bool IsAVX2Supported()
+        {
+            // The processor must support AVX2 and the system must preserve the YMM registers across context switches
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+
+            __cpuid(info, 1);
+            constexpr int osxsave = 1 << 27, avx = 1 << 28;
+            if ((info[2] & (osxsave | avx)) != (osxsave | avx) || (_xgetbv(0) & 0x6) != 0x6)
+                return false;
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+        }
+    #endif
+
+        VertexTransform::Kernel DetectKernel()
+        {
+            if (VertexTransform::IsSupported(VertexTransform::Kernel::AVX2))
+                return VertexTransform::Kernel::AVX2;
+
+            if (VertexTransform::IsSupported(VertexTransform::Kernel::SSE2))
+                return VertexTransform::Kernel::SSE2;
+
+            return VertexTransform::Kernel::Scalar;
+        }
+    }
+
+    VertexTransform::Kernel VertexTransform::GetKernel()
+    {
+        static const Kernel kernel = DetectKernel();
+        return kernel;
+    }
+
+    bool VertexTransform::IsSupported(const Kernel kernel)
+    {
+        switch (kernel)
+        {
+            case Kernel::Scalar:
+                return true;
+            case Kernel::SSE2:
+            #if defined(GENODE_VERTEX_SSE2)
+                return true;
+            #else
+                return false;
+            #endif
+            case Kernel::AVX2:
+            #if defined(GENODE_VERTEX_AVX2) && (defined(__GNUC__) || defined(__clang__))
+                return __builtin_cpu_supports("avx2");
+            #elif defined(GENODE_VERTEX_AVX2)
+                return IsAVX2Supported();
+            #else
+                return false;
+            #endif
+            default:
+                return false;
+        }
+    }
+
+    void VertexTransform::Transform(const sf::Transform& transform, const sf::Vertex* input, sf::Vertex* output, const std::size_t count)
+    {
+        if (transform == sf::Transform::Identity)
+        {
+            if (input != output && count > 0)
+                std::memcpy(output, input, sizeof(sf::Vertex) * count);
+
+            return;
+        }
+
+        Transform(transform, input, output, count, GetKernel());
+    }
+
+    void VertexTransform::Transform(const sf::Transform& transform, const sf::Vertex* input, sf::Vertex* output, const std::size_t count, const Kernel kernel)
+    {
+        if (!IsSupported(kernel))
+            throw NotSupportedException("Vertex transform kernel is not supported on this system");
+
+        if (count == 0)
+            return;
+
+        // Colors and texture coordinates are carried over, positions are transformed in place
+        if (input != output)
+            std::memcpy(output, input, sizeof(sf::Vertex) * count);
+
+        const float* matrix = transform.getMatrix();
+        switch (kernel)
+        {
+        #if defined(GENODE_VERTEX_AVX2)
+            case Kernel::AVX2:
+            {
+                const auto transformed = TransformAVX2(matrix, output, count);
+                TransformSSE2(matrix, output + transformed, count - transformed);
+                break;
+            }
+        #endif
+        #if defined(GENODE_VERTEX_SSE2)
+            case Kernel::SSE2:
+                TransformSSE2(matrix, output, count);
+                break;
+        #endif
+            default:
+                TransformScalar(matrix, output, count);
+                break;
+        }
+    }
+}
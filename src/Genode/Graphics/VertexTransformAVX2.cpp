@@ -0,0 +1,48 @@
+#include <Genode/Graphics/VertexKernels.hpp>
+
+#if defined(GENODE_VERTEX_AVX2)
+#include <immintrin.h>
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define GENODE_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define GENODE_TARGET_AVX2
+#endif
+
+namespace Gx
+{
+    // Same operation order as sf::Transform::transformPoint, see VertexTransform.cpp
+    GENODE_TARGET_AVX2 std::size_t TransformAVX2(const float* matrix, sf::Vertex* vertices, const std::size_t count)
+    {
+        const __m256 mx = _mm256_setr_ps(matrix[0], matrix[1], matrix[0], matrix[1], matrix[0], matrix[1], matrix[0], matrix[1]);
+        const __m256 my = _mm256_setr_ps(matrix[4], matrix[5], matrix[4], matrix[5], matrix[4], matrix[5], matrix[4], matrix[5]);
+        const __m256 mt = _mm256_setr_ps(matrix[12], matrix[13], matrix[12], matrix[13], matrix[12], matrix[13], matrix[12], matrix[13]);
+
+        // Four positions per register: [x0 y0 x1 y1 | x2 y2 x3 y3]
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            auto* a = reinterpret_cast<__m64*>(&vertices[i].position);
+            auto* b = reinterpret_cast<__m64*>(&vertices[i + 1].position);
+            auto* c = reinterpret_cast<__m64*>(&vertices[i + 2].position);
+            auto* d = reinterpret_cast<__m64*>(&vertices[i + 3].position);
+
+            const __m128 low    = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), a), b);
+            const __m128 high   = _mm_loadh_pi(_mm_loadl_pi(_mm_setzero_ps(), c), d);
+            const __m256 points = _mm256_insertf128_ps(_mm256_castps128_ps256(low), high, 1);
+            const __m256 xs     = _mm256_shuffle_ps(points, points, _MM_SHUFFLE(2, 2, 0, 0));
+            const __m256 ys     = _mm256_shuffle_ps(points, points, _MM_SHUFFLE(3, 3, 1, 1));
+            const __m256 result = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xs, mx), _mm256_mul_ps(ys, my)), mt);
+
+            const __m128 resultLow  = _mm256_castps256_ps128(result);
+            const __m128 resultHigh = _mm256_extractf128_ps(result, 1);
+            _mm_storel_pi(a, resultLow);
+            _mm_storeh_pi(b, resultLow);
+            _mm_storel_pi(c, resultHigh);
+            _mm_storeh_pi(d, resultHigh);
+        }
+
+        return i;
+    }
+}
+#endif
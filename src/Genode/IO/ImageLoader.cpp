@@ -0,0 +1,32 @@
+#include <Genode/IO/Loaders/ImageLoader.hpp>
+#include <Genode/IO/LocalFileSystem.hpp>
+
+namespace Gx
+{
+    ResourcePtr<sf::Image> ImageLoader::LoadFromFile(const std::filesystem::path& fileName, const ResourceContext& ctx) const
+    {
+        auto resource = std::make_unique<sf::Image>();
+        if (!resource->loadFromFile(LocalFileSystem::Instance().GetFullName(fileName)))
+            return nullptr;
+
+        return resource;
+    }
+
+    ResourcePtr<sf::Image> ImageLoader::LoadFromMemory(void* data, const std::size_t size, const ResourceContext& ctx) const
+    {
+        auto resource = std::make_unique<sf::Image>();
+        if (!resource->loadFromMemory(data, size))
+            return nullptr;
+
+        return resource;
+    }
+
+    ResourcePtr<sf::Image> ImageLoader::LoadFromStream(sf::InputStream& stream, const ResourceContext& ctx) const
+    {
+        auto resource = std::make_unique<sf::Image>();
+        if (!resource->loadFromStream(stream))
+            return nullptr;
+
+        return resource;
+    }
+}
@@ -1,6 +1,7 @@
 #include <Genode/IO/ResourceLoaderFactory.hpp>
 
 #include <Genode/IO/Loaders/TextureLoader.hpp>
+#include <Genode/IO/Loaders/ImageLoader.hpp>
 #include <Genode/IO/Loaders/FontLoader.hpp>
 #include <Genode/IO/Loaders/SoundBufferLoader.hpp>
 
@@ -18,6 +19,10 @@ void Gx::ResourceLoaderFactory::EnsureDefaultLoadersRegistered()
         if (it == m_loaders.end() || it->second.empty())
             Register<sf::Texture, TextureLoader>();
 
+        it = m_loaders.find(typeid(sf::Image));
+        if (it == m_loaders.end() || it->second.empty())
+            Register<sf::Image, ImageLoader>();
+
         it = m_loaders.find(typeid(Font));
         if (it == m_loaders.end() || it->second.empty())
             Register<Font, FontLoader>();
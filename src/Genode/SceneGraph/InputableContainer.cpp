@@ -2,22 +2,23 @@
 
 namespace Gx
 {
-    std::vector<Inputable*> InputableContainer::GetInputableChildren() const
+    NodeRange<Inputable> InputableContainer::GetInputableChildren() const
     {
         const auto latestVersion = GetVersion();
-        if (m_version != latestVersion)
+        // The cache is held by any live range, so it is only rebuilt outside of an iteration
+        if (m_version != latestVersion && !IsIterating())
         {
             m_inputables.clear();
             for (const auto child : GetChildren())
             {
-                if (const auto inputable = dynamic_cast<Inputable*>(child))
+                if (const auto inputable = child->AsInputable())
                     m_inputables.push_back(inputable);
             }
 
             m_version = latestVersion;
         }
 
-        return m_inputables;
+        return {*this, m_inputables};
     }
 
     bool InputableContainer::Input(const sf::Event& ev)
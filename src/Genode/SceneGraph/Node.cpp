@@ -1,11 +1,15 @@
 ﻿#include <Genode/SceneGraph/Node.hpp>
+#include <Genode/SceneGraph/NodeQuery.hpp>
 #include <Genode/System/Exception.hpp>
+#include <Genode/Entities/Renderable.hpp>
+#include <Genode/Entities/Updatable.hpp>
+#include <Genode/Entities/Inputable.hpp>
+#include <Genode/Entities/Presentable.hpp>
+#include <Genode/SceneGraph/UpdatableContainer.hpp>
+#include <Genode/UI/Control.hpp>
 
-#include <fmt/format.h>
 #include <algorithm>
-#include <regex>
 #include <string>
-#include <Genode/Utilities/StringHelper.hpp>
 
 namespace Gx
 {
@@ -24,6 +28,7 @@ namespace Gx
         if (this != &other)
         {
             Transformable::operator=(other);
+            InvalidateWorldTransform();
             m_parent = nullptr;
             m_state  = other.m_state;
             m_name   = other.m_name;
@@ -36,6 +41,22 @@ namespace Gx
         return *this;
     }
 
+    Node::~Node()
+    {
+        // Parents that deferred a mutation of this node must not reach it once their iteration ends
+        for (const auto parent : m_deferrers)
+            parent->DropDeferred(*this);
+
+        for (const auto& [mutation, child] : m_deferred)
+        {
+            if (child && mutation != Mutation::Detach)
+            {
+                auto& deferrers = child->m_deferrers;
+                deferrers.erase(std::remove(deferrers.begin(), deferrers.end(), this), deferrers.end());
+            }
+        }
+    }
+
     void Node::Initialize()
     {
         m_state = State::Initialized;
@@ -61,33 +82,12 @@ namespace Gx
 
     bool Node::Match(const std::string& id, const std::string& pattern)
     {
-        const static std::unordered_set reserved =
-        {
-            '.', '^', '$', '*', '+', '?', '(', ')', '[', ']', '{', '}', '\\', '|'
-        };
-
-        std::string rxp;
-        for (const char& ch : pattern)
-        {
-            if (ch == '*')
-                rxp += "[^/]*";
-            else if (ch == '?')
-                rxp += "[^/]";
-            else if (reserved.count(ch))
-                rxp += fmt::format("\\{}", ch);
-            else
-                rxp += ch;
-        }
-
-        const std::regex regex(fmt::format("^{}$", rxp));
-        return std::regex_match(id, regex);
+        return NodeQuery::Match(id, pattern);
     }
 
     bool Node::Match(const Node& node, const std::string& pattern)
     {
-        return Match(node.m_name, pattern) ||
-            (node.m_parent && Match(node.m_name, fmt::format("{}/{}", node.m_parent->m_name, pattern))) ||
-            (pattern.find("/") == std::string::npos && StringHelper::EndsWith(node.m_name, pattern));
+        return NodeQuery::Match(node, pattern);
     }
 
     bool Node::Match(const std::string& pattern) const
@@ -102,8 +102,14 @@ namespace Gx
 
     void Node::SetName(const std::string& name)
     {
+        if (m_parent)
+            m_parent->UnindexChild(*this, true, false);
+
         m_name = name;
         m_version++;
+
+        if (m_parent)
+            m_parent->IndexChild(*this, true, false);
     }
 
     const std::string& Node::GetTag() const
@@ -113,8 +119,14 @@ namespace Gx
 
     void Node::SetTag(const std::string& tag)
     {
+        if (m_parent)
+            m_parent->UnindexChild(*this, false, true);
+
         m_tag = tag;
         m_version++;
+
+        if (m_parent)
+            m_parent->IndexChild(*this, false, true);
     }
 
     std::uint64_t Node::GetVersion() const
@@ -132,7 +144,7 @@ namespace Gx
         return m_parent;
     }
 
-    std::vector<Node*> Node::GetChildren() const
+    NodeRange<Node> Node::GetChildren() const
     {
         if (m_state == State::Initialized && !m_pending.empty())
         {
@@ -148,26 +160,28 @@ namespace Gx
             m_pending.clear();
         }
 
-        return m_children;
+        return {*this, m_children};
     }
 
     std::vector<Node*> Node::GetChildrenByTag(const std::string& tag) const
     {
         auto nodes = std::vector<Node*>();
-        for (auto& child : m_children)
+        if (const auto index = GetIndex())
         {
-            if (child->m_tag == tag)
-            {
-                if (m_state == State::Initialized && child->m_state != State::Initialized)
-                {
-                    child->Initialize();
-                    child->m_state = State::Initialized;
+            // Initializing a child may rename it, so the bucket is copied before children are prepared
+            if (const auto it = index->Tags.find(tag); it != index->Tags.end())
+                nodes = it->second;
 
-                    m_pending.erase(child);
-                }
+            for (const auto child : nodes)
+                Prepare(child);
 
-                nodes.push_back(child);
-            }
+            return nodes;
+        }
+
+        for (auto& child : m_children)
+        {
+            if (child->m_parent == this && child->m_tag == tag)
+                nodes.push_back(Prepare(child));
         }
 
         return nodes;
@@ -175,66 +189,340 @@ namespace Gx
 
     Node* Node::GetChildByName(const std::string& name) const
     {
+        // Exact names win over partial ones (e.g. "parent/child" or any other suffix), so the index and the scan agree
+        // on the result. Only plain names can be served by the index, patterns and partial names still require a scan.
+        const bool plain = name.find_first_of("*?/") == std::string::npos;
+        if (const auto index = GetIndex(); index && plain)
+        {
+            if (const auto it = index->Names.find(name); it != index->Names.end() && !it->second.empty())
+                return Prepare(it->second.front());
+        }
+
+        Node* partial = nullptr;
         for (const auto& child : m_children)
         {
-            if (child->Match(name))
-            {
-                if (m_state == State::Initialized && child->m_state != State::Initialized)
-                {
-                    child->Initialize();
-                    child->m_state = State::Initialized;
+            if (child->m_parent != this)
+                continue;
 
-                    m_pending.erase(child);
-                }
+            if (plain && child->m_name == name)
+                return Prepare(child);
 
-                return child;
+            if (!partial && child->Match(name))
+            {
+                partial = child;
+                if (!plain)
+                    break;
             }
         }
 
-        return nullptr;
+        return partial ? Prepare(partial) : nullptr;
     }
 
     Node* Node::GetChildByTag(const std::string& tag) const
     {
+        if (const auto index = GetIndex())
+        {
+            if (const auto it = index->Tags.find(tag); it != index->Tags.end() && !it->second.empty())
+                return Prepare(it->second.front());
+
+            return nullptr;
+        }
+
         for (const auto& child : m_children)
         {
-            if (child->m_tag == tag)
+            if (child->m_parent == this && child->m_tag == tag)
+                return Prepare(child);
+        }
+
+        return nullptr;
+    }
+
+    std::size_t Node::GetChildrenCount() const
+    {
+        return m_children.size();
+    }
+
+    const sf::Transform& Node::GetWorldTransform() const
+    {
+        if (m_worldTransformNeedUpdate)
+        {
+            m_worldTransform = m_parent ? m_parent->GetWorldTransform() * GetTransform() : GetTransform();
+            m_worldTransformNeedUpdate = false;
+        }
+
+        return m_worldTransform;
+    }
+
+    void Node::OnTransformChanged()
+    {
+        InvalidateWorldTransform();
+    }
+
+    void Node::InvalidateWorldTransform()
+    {
+        // A clean node always has clean ancestors, so a dirty node already has dirty descendants
+        if (m_worldTransformNeedUpdate)
+            return;
+
+        m_worldTransformNeedUpdate = true;
+        OnWorldTransformInvalidated();
+
+        for (const auto child : m_children)
+            child->InvalidateWorldTransform();
+    }
+
+    void Node::OnWorldTransformInvalidated()
+    {
+    }
+
+    Node* Node::Prepare(Node* child) const
+    {
+        if (m_state == State::Initialized && child->m_state != State::Initialized)
+        {
+            child->Initialize();
+            child->m_state = State::Initialized;
+
+            m_pending.erase(child);
+        }
+
+        return child;
+    }
+
+    Node::ChildIndex* Node::GetIndex() const
+    {
+        // Small containers are faster to scan, the index is only built once a container grows large enough
+        if (!m_index && m_children.size() >= INDEX_THRESHOLD)
+        {
+            m_index = std::make_unique<ChildIndex>();
+            for (const auto child : m_children)
             {
-                if (m_state == State::Initialized && child->m_state != State::Initialized)
-                {
-                    child->Initialize();
-                    child->m_state = State::Initialized;
+                // Skip children that were moved to another parent while their removal is deferred
+                if (child->m_parent == this)
+                    IndexChild(*child, true, true);
+            }
+        }
+
+        return m_index.get();
+    }
+
+    void Node::IndexChild(Node& child, const bool name, const bool tag) const
+    {
+        if (!m_index)
+            return;
+
+        const auto insert = [&child] (std::vector<Node*>& bucket)
+        {
+            const auto position = std::lower_bound(bucket.begin(), bucket.end(), child.m_order,
+                [] (const Node* node, const std::uint64_t order) { return node->m_order < order; }
+            );
+
+            bucket.insert(position, &child);
+        };
 
-                    m_pending.erase(child);
+        if (name)
+            insert(m_index->Names[child.m_name]);
+
+        if (tag)
+            insert(m_index->Tags[child.m_tag]);
+    }
+
+    void Node::UnindexChild(Node& child, const bool name, const bool tag) const
+    {
+        if (!m_index)
+            return;
+
+        const auto erase = [&child] (auto& map, const std::string& key)
+        {
+            if (const auto it = map.find(key); it != map.end())
+            {
+                auto& bucket = it->second;
+                bucket.erase(std::remove(bucket.begin(), bucket.end(), &child), bucket.end());
+                if (bucket.empty())
+                    map.erase(it);
+            }
+        };
+
+        if (name)
+            erase(m_index->Names, child.m_name);
+
+        if (tag)
+            erase(m_index->Tags, child.m_tag);
+    }
+
+    bool Node::IsIterating() const
+    {
+        return m_iterations > 0;
+    }
+
+    bool Node::HasCapability(const Capability capability) const
+    {
+        return (GetInterfaces().Mask & static_cast<std::uint8_t>(capability)) != 0;
+    }
+
+    Renderable* Node::AsRenderable() const
+    {
+        return GetInterfaces().AsRenderable;
+    }
+
+    Updatable* Node::AsUpdatable() const
+    {
+        return GetInterfaces().AsUpdatable;
+    }
+
+    Inputable* Node::AsInputable() const
+    {
+        return GetInterfaces().AsInputable;
+    }
+
+    Presentable* Node::AsPresentable() const
+    {
+        return GetInterfaces().AsPresentable;
+    }
+
+    Control* Node::AsControl() const
+    {
+        return GetInterfaces().AsControl;
+    }
+
+    UpdatableContainer* Node::AsUpdatableContainer() const
+    {
+        return GetInterfaces().AsUpdatableContainer;
+    }
+
+    const Node::Interfaces& Node::GetInterfaces() const
+    {
+        if (!m_interfaces.Resolved)
+        {
+            auto& self = const_cast<Node&>(*this);
+            m_interfaces.AsRenderable         = dynamic_cast<Renderable*>(&self);
+            m_interfaces.AsUpdatable          = dynamic_cast<Updatable*>(&self);
+            m_interfaces.AsInputable          = dynamic_cast<Inputable*>(&self);
+            m_interfaces.AsPresentable        = dynamic_cast<Presentable*>(&self);
+            m_interfaces.AsControl            = dynamic_cast<Control*>(&self);
+            m_interfaces.AsUpdatableContainer = dynamic_cast<UpdatableContainer*>(&self);
+
+            m_interfaces.Mask = static_cast<std::uint8_t>(
+                (m_interfaces.AsRenderable         ? static_cast<std::uint8_t>(Capability::Renderable)         : 0) |
+                (m_interfaces.AsUpdatable          ? static_cast<std::uint8_t>(Capability::Updatable)          : 0) |
+                (m_interfaces.AsInputable          ? static_cast<std::uint8_t>(Capability::Inputable)          : 0) |
+                (m_interfaces.AsPresentable        ? static_cast<std::uint8_t>(Capability::Presentable)        : 0) |
+                (m_interfaces.AsControl            ? static_cast<std::uint8_t>(Capability::Control)            : 0) |
+                (m_interfaces.AsUpdatableContainer ? static_cast<std::uint8_t>(Capability::UpdatableContainer) : 0)
+            );
+
+            m_interfaces.Resolved = true;
+        }
+
+        return m_interfaces;
+    }
+
+    void Node::BeginIteration() const
+    {
+        m_iterations++;
+    }
+
+    void Node::EndIteration() const
+    {
+        if (--m_iterations > 0 || m_deferred.empty())
+            return;
+
+        // Mutations were requested through a non-const node, they were only held back until iteration ended
+        auto& self     = const_cast<Node&>(*this);
+        auto mutations = std::move(m_deferred);
+        m_deferred.clear();
+
+        // Children destroyed in the meantime are only erased, before any other mutation can reach them
+        for (const auto& [mutation, child] : mutations)
+        {
+            if (mutation != Mutation::Detach)
+            {
+                if (child)
+                {
+                    auto& deferrers = child->m_deferrers;
+                    if (const auto it = std::find(deferrers.begin(), deferrers.end(), this); it != deferrers.end())
+                        deferrers.erase(it);
                 }
 
-                return child;
+                continue;
+            }
+
+            if (const auto it = std::find(self.m_children.begin(), self.m_children.end(), child); it != self.m_children.end())
+            {
+                m_pending.erase(child);
+                self.m_children.erase(it);
+                self.m_version++;
             }
         }
 
-        return nullptr;
+        for (const auto& [mutation, child] : mutations)
+        {
+            switch (mutation)
+            {
+                case Mutation::Add:    self.AddChild(*child);    break;
+                case Mutation::Remove: self.RemoveChild(*child); break;
+                case Mutation::Clear:  self.ClearChildren();     break;
+                case Mutation::Detach: break;
+            }
+        }
     }
 
-    std::size_t Node::GetChildrenCount() const
+    void Node::DropDeferred(Node& child) const
     {
-        return m_children.size();
+        for (auto it = m_deferred.begin(); it != m_deferred.end();)
+        {
+            if (it->second != &child || it->first == Mutation::Detach)
+            {
+                ++it;
+                continue;
+            }
+
+            // A pending removal still has to take the child out of the children, just without touching it anymore
+            if (it->first == Mutation::Remove)
+            {
+                UnindexChild(child, true, true);
+                it->first = Mutation::Detach;
+                ++it;
+            }
+            else
+                it = m_deferred.erase(it);
+        }
     }
 
     void Node::AddChild(Node& child)
     {
+        if (IsIterating())
+        {
+            m_deferred.emplace_back(Mutation::Add, &child);
+            child.m_deferrers.push_back(this);
+            return;
+        }
+
+        // Resolve the interfaces of the child while attaching, so traversal never has to
+        static_cast<void>(child.GetInterfaces());
+
         bool added = false;
         if (std::find(m_children.begin(), m_children.end(), &child) == m_children.end())
         {
             if (child.m_parent)
+            {
+                // The old parent may defer the removal, but lookups through it must not find the child anymore
+                child.m_parent->UnindexChild(child, true, true);
                 child.m_parent->RemoveChild(child);
+            }
 
             child.m_parent = this;
+            child.m_order  = m_nextOrder++;
+            child.InvalidateWorldTransform();
             m_children.push_back(&child);
+            IndexChild(child, true, true);
 
             added = true;
         }
-        else
+        else if (child.m_parent != this)
+        {
             child.m_parent = this;
+            child.InvalidateWorldTransform();
+        }
 
         if (m_state == State::Initialized && child.m_state != State::Initialized)
         {
@@ -254,14 +542,28 @@ namespace Gx
 
     void Node::RemoveChild(Node& child)
     {
+        if (IsIterating())
+        {
+            m_deferred.emplace_back(Mutation::Remove, &child);
+            child.m_deferrers.push_back(this);
+            return;
+        }
+
+        // A deferred removal may arrive after the child was already moved to another parent
+        const bool reparented = child.m_parent && child.m_parent != this;
         if (child.m_parent == this)
+        {
             child.m_parent = nullptr;
+            child.InvalidateWorldTransform();
+        }
 
         const auto iterator = std::find(m_children.begin(), m_children.end(), &child);
         if (iterator != m_children.end())
         {
             m_version++;
-            if (child.m_state != State::Finalized)
+            if (reparented)
+                OnChildRemove(child);
+            else if (child.m_state != State::Finalized)
             {
                 OnChildRemove(child);
 
@@ -269,6 +571,7 @@ namespace Gx
                 child.m_state = State::Finalized;
             }
 
+            UnindexChild(child, true, true);
             m_pending.erase(*iterator);
             m_children.erase(iterator);
         }
@@ -276,9 +579,16 @@ namespace Gx
 
     void Node::ClearChildren()
     {
+        if (IsIterating())
+        {
+            m_deferred.emplace_back(Mutation::Clear, nullptr);
+            return;
+        }
+
         for (const auto child : m_children)
         {
             child->m_parent = nullptr;
+            child->InvalidateWorldTransform();
 
             if (child->m_state != State::Finalized)
             {
@@ -291,6 +601,7 @@ namespace Gx
 
         m_pending.clear();
         m_children.clear();
+        m_index.reset();
 
         m_version++;
     }
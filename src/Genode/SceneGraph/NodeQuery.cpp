@@ -0,0 +1,200 @@
+#include <Genode/SceneGraph/NodeQuery.hpp>
+#include <Genode/SceneGraph/Node.hpp>
+
+namespace Gx
+{
+    NodeQuery::NodeQuery(const std::string& pattern) :
+        m_pattern(pattern)
+    {
+        std::size_t offset = 0;
+        while (true)
+        {
+            const auto separator = m_pattern.find('/', offset);
+            const auto length    = (separator == std::string::npos ? m_pattern.size() : separator) - offset;
+            const auto literal   = m_pattern.find_first_of("*?", offset) >= offset + length;
+
+            m_segments.push_back(Segment{offset, length, literal});
+            if (separator == std::string::npos)
+                break;
+
+            offset = separator + 1;
+        }
+    }
+
+    bool NodeQuery::Match(const std::string_view id, const std::string_view pattern)
+    {
+        return MatchPath(id, pattern);
+    }
+
+    bool NodeQuery::Match(const Node& node, const std::string_view pattern)
+    {
+        return MatchNode(node, pattern, [pattern] (const std::string_view id) { return MatchPath(id, pattern); });
+    }
+
+    const std::string& NodeQuery::GetPattern() const
+    {
+        return m_pattern;
+    }
+
+    std::size_t NodeQuery::GetDepth() const
+    {
+        return m_segments.size();
+    }
+
+    bool NodeQuery::Match(std::string_view id) const
+    {
+        for (std::size_t i = 0; i < m_segments.size(); i++)
+        {
+            const auto separator = id.find('/');
+            const auto last      = i + 1 == m_segments.size();
+            if (last != (separator == std::string_view::npos))
+                return false;
+
+            if (!MatchSegment(id.substr(0, separator), m_segments[i]))
+                return false;
+
+            if (!last)
+                id.remove_prefix(separator + 1);
+        }
+
+        return !m_segments.empty();
+    }
+
+    bool NodeQuery::Match(const Node& node) const
+    {
+        return MatchNode(node, m_pattern, [this] (const std::string_view id) { return Match(id); });
+    }
+
+    std::vector<Node*> NodeQuery::Find(const Node& root) const
+    {
+        auto results = std::vector<Node*>();
+        Find(root, results);
+
+        return results;
+    }
+
+    Node* NodeQuery::FindFirst(const Node& root) const
+    {
+        if (m_segments.empty())
+            return nullptr;
+
+        return Find(root, 0, nullptr);
+    }
+
+    void NodeQuery::Find(const Node& root, std::vector<Node*>& results) const
+    {
+        if (!m_segments.empty())
+            Find(root, 0, &results);
+    }
+
+    bool NodeQuery::MatchSegment(const std::string_view text, const std::string_view pattern)
+    {
+        // Greedy wildcard matching that backtracks to the last star only, linear for typical patterns
+        std::size_t t = 0, p = 0, star = std::string_view::npos, mark = 0;
+        while (t < text.size())
+        {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t]))
+            {
+                p++;
+                t++;
+            }
+            else if (p < pattern.size() && pattern[p] == '*')
+            {
+                star = p++;
+                mark = t;
+            }
+            else if (star != std::string_view::npos)
+            {
+                p = star + 1;
+                t = ++mark;
+            }
+            else
+                return false;
+        }
+
+        while (p < pattern.size() && pattern[p] == '*')
+            p++;
+
+        return p == pattern.size();
+    }
+
+    bool NodeQuery::MatchPath(std::string_view id, std::string_view pattern)
+    {
+        // Wildcards never cross a separator, so both sides are matched one segment at a time
+        while (true)
+        {
+            const auto idSeparator      = id.find('/');
+            const auto patternSeparator = pattern.find('/');
+            if ((idSeparator == std::string_view::npos) != (patternSeparator == std::string_view::npos))
+                return false;
+
+            if (!MatchSegment(id.substr(0, idSeparator), pattern.substr(0, patternSeparator)))
+                return false;
+
+            if (idSeparator == std::string_view::npos)
+                return true;
+
+            id.remove_prefix(idSeparator + 1);
+            pattern.remove_prefix(patternSeparator + 1);
+        }
+    }
+
+    template<typename Matcher>
+    bool NodeQuery::MatchNode(const Node& node, const std::string_view pattern, const Matcher& matcher)
+    {
+        const std::string_view name = node.GetName();
+        if (matcher(name))
+            return true;
+
+        // Names may be qualified with the name of their parent, e.g. "parent/child" matches the pattern "child"
+        if (const auto parent = node.GetParent())
+        {
+            const std::string_view prefix = parent->GetName();
+            if (name.size() > prefix.size() && name.compare(0, prefix.size(), prefix) == 0 && name[prefix.size()] == '/')
+            {
+                if (MatchPath(name.substr(prefix.size() + 1), pattern))
+                    return true;
+            }
+        }
+
+        return pattern.find('/') == std::string_view::npos && name.size() >= pattern.size() &&
+            name.compare(name.size() - pattern.size(), pattern.size(), pattern) == 0;
+    }
+
+    std::string_view NodeQuery::GetSegment(const Segment& segment) const
+    {
+        return std::string_view(m_pattern).substr(segment.Offset, segment.Length);
+    }
+
+    bool NodeQuery::MatchSegment(const std::string_view text, const Segment& segment) const
+    {
+        if (segment.Literal)
+            return text == GetSegment(segment);
+
+        return MatchSegment(text, GetSegment(segment));
+    }
+
+    Node* NodeQuery::Find(const Node& node, const std::size_t depth, std::vector<Node*>* results) const
+    {
+        const auto& segment = m_segments[depth];
+        const auto last     = depth + 1 == m_segments.size();
+
+        for (const auto child : node.GetChildren())
+        {
+            if (!MatchSegment(child->GetName(), segment))
+                continue;
+
+            if (!last)
+            {
+                if (const auto found = Find(*child, depth + 1, results))
+                    return found;
+            }
+            else if (results)
+                results->push_back(child);
+            else
+                return child;
+        }
+
+        return nullptr;
+    }
+}
@@ -17,11 +17,26 @@ namespace Gx
         return m_batcher.GetBatchUsage();
     }
 
+    void RenderBatchContainer::SetBatchGeometry(const SpriteBatch::Geometry geometry) const
+    {
+        m_batcher.SetBatchGeometry(geometry);
+    }
+
+    SpriteBatch::Geometry RenderBatchContainer::GetBatchGeometry() const
+    {
+        return m_batcher.GetBatchGeometry();
+    }
+
     VertexPool& RenderBatchContainer::GetVertexPool() const
     {
         return m_batcher.GetVertexPool();
     }
 
+    void RenderBatchContainer::InvalidateBatch() const
+    {
+        m_batcher.InvalidateBatch();
+    }
+
     void RenderBatchContainer::Update(const sf::Time& delta)
     {
         m_batcher.Update(delta);
@@ -30,6 +45,7 @@ namespace Gx
 
     RenderStates RenderBatchContainer::Render(RenderSurface& surface, RenderStates states) const
     {
+        ResetCullingCounters();
         if (!IsVisible())
             return states;
 
@@ -40,21 +56,39 @@ namespace Gx
         // Reset transform
         states.transform = sf::Transform();
 
+        // Static batches keep their uploaded vertices until the children change
+        if (m_batchVersion != GetVersion())
+        {
+            m_batcher.InvalidateBatch();
+            m_batchVersion = GetVersion();
+        }
+
+        // Submissions are culled by the batcher in batch space, where the container transform is not applied yet.
+        // Culling children here as well would shift the batched runs and count every culled child twice.
+        m_batcher.SetCulling(IsCulling());
+        if (const auto viewBounds = IsCulling() ? surface.GetViewBounds() : std::nullopt)
+            m_batcher.SetViewBounds(transform.getInverse().transformRect(*viewBounds));
+
         // Render child with sprite batch
-        for (const auto node : GetRenderableChildren())
+        if (m_batcher.IsSubmissionRequired())
         {
-            states.Layer += 1.f;
-            if (const auto renderable = dynamic_cast<Renderable*>(node))
+            for (const auto renderable : GetRenderableChildren())
+            {
+                states.Layer += 1.f;
                 renderable->Render(m_batcher, states);
 
-            // Pop batch level
-            states.Layer = layer;
+                // Pop batch level
+                states.Layer = layer;
+            }
         }
 
         // Pop transform
         states.transform = transform;
 
         // Render sprite batch
-        return m_batcher.Render(surface, states);
+        states = m_batcher.Render(surface, states);
+        SetCullingCounters(m_batcher.GetCulledSubmissionCount(), m_batcher.GetDrawnSubmissionCount());
+
+        return states;
     }
 }
\ No newline at end of file
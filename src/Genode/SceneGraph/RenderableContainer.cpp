@@ -2,33 +2,90 @@
 
 namespace Gx
 {
-    std::vector<Renderable*> RenderableContainer::GetRenderableChildren() const
+    void RenderableContainer::SetCulling(const bool culling)
+    {
+        m_culling = culling;
+    }
+
+    bool RenderableContainer::IsCulling() const
+    {
+        return m_culling;
+    }
+
+    std::size_t RenderableContainer::GetCulledCount() const
+    {
+        return m_culledCount;
+    }
+
+    std::size_t RenderableContainer::GetDrawnCount() const
+    {
+        return m_drawnCount;
+    }
+
+    NodeRange<Renderable> RenderableContainer::GetRenderableChildren() const
     {
         const auto latestVersion = GetVersion();
-        if (m_version != latestVersion)
+        // The cache is held by any live range, so it is only rebuilt outside of an iteration
+        if (m_version != latestVersion && !IsIterating())
         {
             m_renderables.clear();
             for (const auto child : GetChildren())
             {
-                if (const auto renderable = dynamic_cast<Renderable*>(child))
+                if (const auto renderable = child->AsRenderable())
                     m_renderables.push_back(renderable);
             }
 
             m_version = latestVersion;
         }
 
-        return m_renderables;
+        return {*this, m_renderables};
+    }
+
+    void RenderableContainer::ResetCullingCounters() const
+    {
+        m_culledCount = 0;
+        m_drawnCount  = 0;
+    }
+
+    void RenderableContainer::SetCullingCounters(const std::size_t culledCount, const std::size_t drawnCount) const
+    {
+        m_culledCount = culledCount;
+        m_drawnCount  = drawnCount;
+    }
+
+    bool RenderableContainer::Cull(const Renderable& renderable, const RenderStates& states, const std::optional<sf::FloatRect>& viewBounds) const
+    {
+        if (m_culling && viewBounds)
+        {
+            if (const auto bounds = renderable.GetRenderBounds())
+            {
+                if (RenderSurface::IsOutsideView(states.transform.transformRect(*bounds), *viewBounds))
+                {
+                    m_culledCount++;
+                    return true;
+                }
+            }
+        }
+
+        m_drawnCount++;
+        return false;
     }
 
     RenderStates RenderableContainer::Render(RenderSurface& surface, RenderStates states) const
     {
+        ResetCullingCounters();
         if (!IsVisible())
             return states;
 
-        for (const auto node : GetRenderableChildren())
+        return RenderChildren(surface, states, m_culling ? surface.GetViewBounds() : std::nullopt);
+    }
+
+    RenderStates RenderableContainer::RenderChildren(RenderSurface& surface, RenderStates states, const std::optional<sf::FloatRect>& viewBounds) const
+    {
+        for (const auto renderable : GetRenderableChildren())
         {
             states.Layer += 1.0f;
-            if (const auto renderable = dynamic_cast<Renderable*>(node))
+            if (!Cull(*renderable, states, viewBounds))
                 renderable->Render(surface, states);
         }
 
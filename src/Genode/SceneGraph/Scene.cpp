@@ -43,6 +43,28 @@ namespace Gx
         return true;
     }
 
+    void Scene::OnLoad(SceneStaging& staging)
+    {
+    }
+
+    bool Scene::OnLoadCompleted(const sf::Time& budget)
+    {
+        return true;
+    }
+
+    void Scene::OnSuspend()
+    {
+    }
+
+    void Scene::OnResume()
+    {
+    }
+
+    std::size_t Scene::GetRetainedMemory() const
+    {
+        return 0;
+    }
+
     Application& Scene::GetApplication() const
     {
         if (!m_director)
@@ -94,14 +116,21 @@ namespace Gx
 
     bool Scene::IsPresenting(Presentable& presentable) const
     {
-        return !m_presentables.empty() && &presentable == *m_presentables.rbegin();
+        return !m_presentables.empty() && &presentable == m_presentables.back().Instance;
     }
 
     void Scene::Present(Presentable& presentable, const PresentationContext& context)
     {
-        if (std::find(m_presentables.begin(), m_presentables.end(), &presentable) == m_presentables.end())
+        const auto match = [&presentable] (const PresentableEntry& entry) { return entry.Instance == &presentable; };
+        if (std::find_if(m_presentables.begin(), m_presentables.end(), match) == m_presentables.end())
         {
-            m_presentables.push_back(&presentable);
+            m_presentables.push_back(PresentableEntry{
+                &presentable,
+                dynamic_cast<Renderable*>(&presentable),
+                dynamic_cast<Updatable*>(&presentable),
+                dynamic_cast<Inputable*>(&presentable)
+            });
+
             if (&context == &PresentationContext::Default)
             {
                 auto ctx = GraphicalPresentationContext();
@@ -113,7 +142,7 @@ namespace Gx
             else
                 Parent::Present(presentable, context);
 
-            if (const auto inputable = dynamic_cast<Inputable*>(&presentable))
+            if (const auto inputable = m_presentables.back().AsInputable)
             {
                 if (m_lastInput.has_value())
                     inputable->Input(m_lastInput.value());
@@ -126,7 +155,8 @@ namespace Gx
         if (!IsPresenting(presentable))
             return false;
 
-        if (const auto it = std::find(m_presentables.begin(), m_presentables.end(), &presentable); it != m_presentables.end())
+        const auto match = [&presentable] (const PresentableEntry& entry) { return entry.Instance == &presentable; };
+        if (const auto it = std::find_if(m_presentables.begin(), m_presentables.end(), match); it != m_presentables.end())
         {
             m_presentables.erase(it);
             Parent::Dismiss(presentable);
@@ -143,7 +173,7 @@ namespace Gx
 
     bool Scene::Dismiss()
     {
-        return Dismiss(**m_presentables.rbegin());
+        return Dismiss(*m_presentables.back().Instance);
     }
 
     void Scene::Invoke(const std::function<void()>& evt)
@@ -176,10 +206,10 @@ namespace Gx
         states = RenderableContainer::Render(surface, states);
         if (!m_presentables.empty())
         {
-            for (const auto presentable : m_presentables)
+            for (const auto& presentable : m_presentables)
             {
-                if (const auto renderable = dynamic_cast<Renderable*>(presentable))
-                    renderable->Render(surface, states);
+                if (presentable.AsRenderable)
+                    presentable.AsRenderable->Render(surface, states);
             }
         }
 
@@ -193,10 +223,10 @@ namespace Gx
 
         if (!m_presentables.empty())
         {
-            for (const auto presentable : m_presentables)
+            for (const auto& presentable : m_presentables)
             {
-                if (const auto updatable = dynamic_cast<Updatable*>(presentable))
-                    updatable->Update(delta);
+                if (presentable.AsUpdatable)
+                    presentable.AsUpdatable->Update(delta);
             }
         }
     }
@@ -208,7 +238,7 @@ namespace Gx
 
         if (!m_presentables.empty())
         {
-            if (const auto inputable = dynamic_cast<Inputable*>(*m_presentables.rbegin()))
+            if (const auto inputable = m_presentables.back().AsInputable)
                 return inputable->Input(ev);
 
             return false;
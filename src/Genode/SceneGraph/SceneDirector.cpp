@@ -3,6 +3,8 @@
 
 #include <Genode/System/Application.hpp>
 
+#include <algorithm>
+
 namespace Gx
 {
 
@@ -16,37 +18,227 @@ namespace Gx
     {
     }
 
+    SceneDirector::~SceneDirector()
+    {
+        for (auto& staging : m_stagings)
+        {
+            staging.Request->Cancel();
+            if (staging.Worker.joinable())
+            {
+                staging.Worker.join();
+                Context::EndConcurrentAccess();
+            }
+        }
+    }
+
     void SceneDirector::Stage()
     {
         if (m_nextScene && !m_staged)
         {
+            auto previous  = std::move(m_currentScene);
             m_currentScene = std::move(m_nextScene);
             m_nextScene = nullptr;
 
-            m_currentScene->SetDirector(*this);
+            // A suspended scene that is presented again right away completes its regular lifecycle instead
+            if (previous && m_suspended)
+            {
+                if (previous.get() != m_currentScene.get())
+                    Retain(std::move(previous));
+                else
+                    previous->Finalize();
+            }
 
-            if (!m_currentScene->m_context.has_value())
-                m_currentScene->SetContext(GetContext().CreateScope());
+            previous    = nullptr;
+            m_suspended = false;
 
-            if (m_initializer)
-                m_initializer(*m_currentScene);
+            m_currentScene->SetDirector(*this);
+
+            if (m_resumed)
+                m_currentScene->OnResume();
             else
-                m_currentScene->Initialize();
+            {
+                if (!m_currentScene->m_context.has_value())
+                    m_currentScene->SetContext(GetContext().CreateScope());
+
+                if (m_initializer)
+                    m_initializer(*m_currentScene);
+                else
+                    m_currentScene->Initialize();
+            }
 
             m_initializer = nullptr;
+            m_resumed = false;
             m_staged = true;
         }
     }
 
+    void SceneDirector::ProcessStaging()
+    {
+        for (std::size_t i = 0; i < m_stagings.size();)
+        {
+            auto& staging = m_stagings[i];
+            const auto request = staging.Request;
+            if (request->m_status == SceneStaging::Status::Loading)
+            {
+                ++i;
+                continue;
+            }
+
+            if (staging.Worker.joinable())
+            {
+                staging.Worker.join();
+                Context::EndConcurrentAccess();
+            }
+
+            if (request->m_status == SceneStaging::Status::Finalizing)
+            {
+                if (request->IsCancelled())
+                {
+                    request->m_scene  = nullptr;
+                    request->m_status = SceneStaging::Status::Cancelled;
+                }
+                else if (request->m_scene->OnLoadCompleted(m_stagingBudget))
+                {
+                    if (staging.Presentation)
+                        m_stack.push(std::move(*staging.Presentation));
+
+                    Discard();
+                    m_initializer = std::move(staging.Initializer);
+                    m_nextScene   = std::move(request->m_scene);
+                    m_resumed     = false;
+                    Unstage();
+
+                    request->m_progress = 1.f;
+                    request->m_status   = SceneStaging::Status::Presented;
+                }
+                else
+                {
+                    ++i;
+                    continue;
+                }
+            }
+            else if (request->m_status == SceneStaging::Status::Failed)
+                request->m_scene = nullptr;
+
+            m_stagings.erase(m_stagings.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+    }
+
+    const sf::Time& SceneDirector::GetStagingBudget() const
+    {
+        return m_stagingBudget;
+    }
+
+    void SceneDirector::SetStagingBudget(const sf::Time& budget)
+    {
+        m_stagingBudget = budget;
+    }
+
     void SceneDirector::Unstage() const
     {
         if (m_currentScene)
         {
-            m_currentScene->Finalize();
+            if (m_retentionCapacity > 0)
+                m_currentScene->OnSuspend();
+            else
+                m_currentScene->Finalize();
+
+            m_suspended = m_retentionCapacity > 0;
             m_staged = false;
         }
     }
 
+    ResourcePtr<Scene> SceneDirector::Deserialize(const std::type_index type, const SceneGenericDeserializer& deserializer, const ResourceContext& context, const bool resumable)
+    {
+        Discard();
+        if (resumable)
+        {
+            for (auto it = m_retained.begin(); it != m_retained.end(); ++it)
+            {
+                if (std::type_index(typeid(**it)) == type)
+                {
+                    auto scene = std::move(*it);
+                    m_retained.erase(it);
+
+                    m_resumed = true;
+                    return scene;
+                }
+            }
+        }
+
+        return deserializer(context);
+    }
+
+    void SceneDirector::Retain(ResourcePtr<Scene> scene)
+    {
+        // Only the latest instance of a scene type is worth keeping
+        const auto type = std::type_index(typeid(*scene));
+        for (auto it = m_retained.begin(); it != m_retained.end(); ++it)
+        {
+            if (std::type_index(typeid(**it)) == type)
+            {
+                (*it)->Finalize();
+                m_retained.erase(it);
+                break;
+            }
+        }
+
+        m_retained.push_front(std::move(scene));
+        Trim(m_retentionCapacity);
+    }
+
+    void SceneDirector::Discard()
+    {
+        // A resumed scene that is replaced before being staged is still suspended, keep it around
+        if (m_nextScene && m_resumed)
+            Retain(std::move(m_nextScene));
+
+        m_nextScene = nullptr;
+        m_resumed   = false;
+    }
+
+    void SceneDirector::Trim(const std::size_t capacity) const
+    {
+        // Suspended scenes are not expected to grow, so their memory is only summed up when the cache changes
+        std::size_t memory = 0;
+        if (m_retentionBudget > 0)
+        {
+            for (const auto& scene : m_retained)
+                memory += scene->GetRetainedMemory();
+        }
+
+        while (m_retained.size() > capacity || (m_retentionBudget > 0 && memory > m_retentionBudget && !m_retained.empty()))
+        {
+            if (m_retentionBudget > 0)
+                memory -= std::min(memory, m_retained.back()->GetRetainedMemory());
+
+            m_retained.back()->Finalize();
+            m_retained.pop_back();
+        }
+    }
+
+    std::size_t SceneDirector::GetRetentionCapacity() const
+    {
+        return m_retentionCapacity;
+    }
+
+    void SceneDirector::SetRetentionCapacity(const std::size_t capacity)
+    {
+        m_retentionCapacity = capacity;
+        Trim(capacity);
+    }
+
+    std::size_t SceneDirector::GetRetentionBudget() const
+    {
+        return m_retentionBudget;
+    }
+
+    void SceneDirector::SetRetentionBudget(const std::size_t bytes)
+    {
+        m_retentionBudget = bytes;
+        Trim(m_retentionCapacity);
+    }
+
     Context& SceneDirector::GetContext() const
     {
         if (const auto app = dynamic_cast<Application*>(&m_surface))
@@ -94,6 +286,7 @@ namespace Gx
 
     void SceneDirector::Update(const sf::Time& delta)
     {
+        ProcessStaging();
         Stage();
 
         if (m_currentScene)
@@ -125,7 +318,7 @@ namespace Gx
             context->Unbind();
         }
 
-        auto scene    = presentation.Deserializer(context ? *context : ResourceContext::Default);
+        auto scene    = Deserialize(presentation.Type, presentation.Deserializer, context ? *context : ResourceContext::Default, true);
         m_initializer = presentation.Initializer;
         m_nextScene   = std::move(scene);
 
@@ -141,7 +334,7 @@ namespace Gx
         m_stack.pop();
         const auto& presentation = m_stack.top();
 
-        auto scene    = presentation.Deserializer(context);
+        auto scene    = Deserialize(presentation.Type, presentation.Deserializer, context, true);
         m_initializer = presentation.Initializer;
         m_nextScene   = std::move(scene);
 
@@ -174,6 +367,7 @@ namespace Gx
             if (m_currentScene->OnAppClose())
             {
                 m_currentScene->Finalize();
+                Trim(0);
                 return true;
             }
 
@@ -185,9 +379,23 @@ namespace Gx
 
     void SceneDirector::Reset()
     {
+        // Suspended scenes never reach Finalize on their own
+        if (m_currentScene && m_suspended)
+            m_currentScene->Finalize();
+
+        if (m_nextScene && m_resumed)
+            m_nextScene->Finalize();
+
         m_currentScene = nullptr;
         m_nextScene    = nullptr;
         m_staged       = true;
-        m_stack      = {};
+        m_suspended    = false;
+        m_resumed      = false;
+        m_stack        = {};
+
+        Trim(0);
+
+        for (auto& staging : m_stagings)
+            staging.Request->Cancel();
     }
 }
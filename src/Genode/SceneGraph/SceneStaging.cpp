@@ -0,0 +1,42 @@
+#include <Genode/SceneGraph/SceneStaging.hpp>
+#include <Genode/SceneGraph/Scene.hpp>
+
+#include <algorithm>
+
+namespace Gx
+{
+    SceneStaging::Status SceneStaging::GetStatus() const
+    {
+        const auto status = m_status.load();
+        if (status == Status::Failed && m_exception)
+            std::rethrow_exception(m_exception);
+
+        return status;
+    }
+
+    bool SceneStaging::IsDone() const
+    {
+        const auto status = m_status.load();
+        return status != Status::Loading && status != Status::Finalizing;
+    }
+
+    bool SceneStaging::IsCancelled() const
+    {
+        return m_cancelled.load();
+    }
+
+    float SceneStaging::GetProgress() const
+    {
+        return m_progress.load();
+    }
+
+    void SceneStaging::Report(const float progress)
+    {
+        m_progress = std::clamp(progress, 0.f, 1.f);
+    }
+
+    void SceneStaging::Cancel()
+    {
+        m_cancelled = true;
+    }
+}
@@ -1,28 +1,164 @@
 #include <Genode/SceneGraph/UpdatableContainer.hpp>
+#include <Genode/System/WorkerPool.hpp>
+
+#include <algorithm>
 
 namespace Gx
 {
-    std::vector<Updatable*> UpdatableContainer::GetUpdatableChildren() const
+    UpdatableContainer::UpdateMode UpdatableContainer::GetUpdateMode() const
+    {
+        return m_updateMode;
+    }
+
+    void UpdatableContainer::SetUpdateMode(const UpdateMode mode)
+    {
+        m_updateMode = mode;
+    }
+
+    bool UpdatableContainer::IsIndependent() const
+    {
+        return m_independent;
+    }
+
+    void UpdatableContainer::SetIndependent(const bool independent)
+    {
+        m_independent = independent;
+    }
+
+    bool UpdatableContainer::IsSleeping() const
+    {
+        return m_sleeping;
+    }
+
+    void UpdatableContainer::Sleep()
+    {
+        if (m_sleeping)
+            return;
+
+        m_sleeping = true;
+        InvalidateParentSchedule();
+    }
+
+    void UpdatableContainer::Wake()
+    {
+        if (!m_sleeping)
+            return;
+
+        m_sleeping    = false;
+        m_tickFrame   = 0;
+        m_tickElapsed = sf::Time::Zero;
+
+        InvalidateParentSchedule();
+    }
+
+    unsigned int UpdatableContainer::GetTickInterval() const
+    {
+        return m_tickInterval;
+    }
+
+    void UpdatableContainer::SetTickInterval(const unsigned int frames)
+    {
+        m_tickInterval = std::max(frames, 1u);
+        m_tickFrame    = std::min(m_tickFrame, m_tickInterval - 1);
+    }
+
+    NodeRange<Updatable> UpdatableContainer::GetUpdatableChildren() const
     {
         const auto latestVersion = GetVersion();
-        if (m_version != latestVersion)
+        // The cache is held by any live range, so it is only rebuilt outside of an iteration
+        if ((m_version != latestVersion || m_scheduleVersion != m_latestScheduleVersion) && !IsIterating())
         {
             m_updatables.clear();
+            m_schedules.clear();
             for (const auto child : GetChildren())
             {
-                if (const auto updatable = dynamic_cast<Updatable*>(child))
-                    m_updatables.push_back(updatable);
+                const auto updatable = child->AsUpdatable();
+                if (!updatable)
+                    continue;
+
+                // Sleeping subtrees are left out of the cache entirely, waking them up invalidates it again
+                const auto container = child->AsUpdatableContainer();
+                if (container && container->m_sleeping)
+                    continue;
+
+                m_updatables.push_back(updatable);
+                m_schedules.push_back(container);
             }
 
-            m_version = latestVersion;
+            m_version         = latestVersion;
+            m_scheduleVersion = m_latestScheduleVersion;
         }
 
-        return m_updatables;
+        return {*this, m_updatables};
     }
 
     void UpdatableContainer::Update(const sf::Time& delta)
     {
-        for (const auto updatable : GetUpdatableChildren())
-            updatable->Update(delta);
+        const auto updatables = GetUpdatableChildren();
+        if (m_updateMode != UpdateMode::Sequential)
+        {
+            m_jobs.clear();
+            for (std::size_t i = 0; i < updatables.size(); i++)
+            {
+                auto elapsed = sf::Time::Zero;
+                if (const auto container = m_schedules[i]; container && container->m_independent && !container->m_sleeping && container->Tick(delta, elapsed))
+                    m_jobs.emplace_back(updatables[i], elapsed);
+            }
+
+            // Workers read the world transform of this container, make sure none of them has to compute it
+            static_cast<void>(GetWorldTransform());
+
+            const auto job = [this] (const std::size_t index) { m_jobs[index].first->Update(m_jobs[index].second); };
+            if (m_updateMode == UpdateMode::Parallel)
+                WorkerPool::GetShared().Run(m_jobs.size(), job);
+            else
+            {
+                for (std::size_t i = 0; i < m_jobs.size(); i++)
+                    job(i);
+            }
+        }
+
+        for (std::size_t i = 0; i < updatables.size(); i++)
+        {
+            const auto container = m_schedules[i];
+            if (!container)
+            {
+                updatables[i]->Update(delta);
+                continue;
+            }
+
+            // Independent children were already updated, the child may also have been put to sleep by a sibling
+            auto elapsed = sf::Time::Zero;
+            if (m_updateMode != UpdateMode::Sequential && container->m_independent)
+                continue;
+
+            if (!container->m_sleeping && container->Tick(delta, elapsed))
+                updatables[i]->Update(elapsed);
+        }
+    }
+
+    void UpdatableContainer::InvalidateParentSchedule() const
+    {
+        if (const auto parent = GetParent() ? GetParent()->AsUpdatableContainer() : nullptr)
+            parent->m_latestScheduleVersion++;
+    }
+
+    bool UpdatableContainer::Tick(const sf::Time& delta, sf::Time& elapsed)
+    {
+        if (m_tickInterval <= 1)
+        {
+            elapsed = delta;
+            return true;
+        }
+
+        m_tickElapsed += delta;
+        if (++m_tickFrame < m_tickInterval)
+            return false;
+
+        elapsed       = m_tickElapsed;
+        m_tickFrame   = 0;
+        m_tickElapsed = sf::Time::Zero;
+
+        return true;
     }
 }
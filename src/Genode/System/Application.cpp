@@ -6,6 +6,7 @@
 #include <Genode/Graphics/Sprite.hpp>
 #include <Genode/UI/Cursor.hpp>
 
+#include <algorithm>
 #include <mutex>
 #include <utility>
 
@@ -20,11 +21,18 @@ namespace Gx
         m_state(fullScreen ? sf::State::Fullscreen : sf::State::Windowed),
         m_mode(mode),
         m_view(view),
+        m_headlessView(view),
         m_settings(settings),
         m_cursor(),
         m_title(std::move(title)),
         m_frameID(0),
         m_renderFreq(0),
+        m_maxUpdateSteps(5),
+        m_fixedTimestep(sf::Time::Zero),
+        m_frameTime(sf::Time::Zero),
+        m_frameLimit(0),
+        m_verticalSync(true),
+        m_headless(false),
         m_fullScreen(fullScreen),
         m_closeRequested(false)
     {
@@ -65,90 +73,90 @@ namespace Gx
         UpdateCursor(sf::Event::Closed());
 
         // Setup timer
-        const auto timer   = sf::Clock();
-        double last        = timer.getElapsedTime().asMilliseconds();
-        std::size_t frames = 0;
-        double fpsDelta    = 0;
+        const auto timer     = sf::Clock();
+        sf::Time last        = timer.getElapsedTime();
+        sf::Time fpsDelta    = sf::Time::Zero;
+        sf::Time unsimulated = sf::Time::Zero;
+        std::size_t frames   = 0;
 
         // Main game loop
         bool initial = true;
-        while (m_window->isOpen())
+        std::size_t processed = 0;
+        while (!m_window || m_window->isOpen())
         {
             // Poll window event
-            while (const auto event = m_window->pollEvent())
+            while (m_window)
             {
-                // Call window event handlers based on received event
-                if (event.has_value() && !event->is<sf::Event::MouseMovedRaw>())
-                {
-                    if (event->is<sf::Event::Closed>())
-                    {
-                        // Ask game permission first before closing
-                        Close();
-                    }
-                    else if (event->is<sf::Event::FocusGained>())
-                    {
-                        OnFocusChanged(true);
-                        if (const auto director = FindModule<SceneDirector>())
-                            director->Focus(true);
-                    }
-                    else if (event->is<sf::Event::FocusLost>())
-                    {
-                        OnFocusChanged(false);
-                        if (const auto director = FindModule<SceneDirector>())
-                            director->Focus(false);
-                    }
-                    else if (const auto e = event->getIf<sf::Event::Resized>())
-                    {
-                        OnResized(e->size);
-                        if (const auto director = FindModule<SceneDirector>())
-                            director->Resize(e->size);
-                    }
-                    else
-                    {
-                        if (event->is<sf::Event::MouseButtonPressed>() || event->is<sf::Event::MouseButtonReleased>())
-                            UpdateCursor(event.value());
+                const auto event = m_window->pollEvent();
+                if (!event.has_value())
+                    break;
 
-                        auto ev = event.value();
-                        OnInputReceived(ev);
-                    }
-                }
+                ProcessEvent(event.value());
+            }
+
+            // Then the synthetic ones
+            while (!m_events.empty())
+            {
+                const auto event = m_events.front();
+                m_events.pop();
+
+                ProcessEvent(event);
             }
 
             // Check if window is closed after polling the events
-            if (m_closeRequested || !m_window->isOpen())
+            if (m_closeRequested || (m_window && !m_window->isOpen()) || (m_frameLimit > 0 && processed >= m_frameLimit))
             {
-                m_window->close();
+                if (m_window)
+                    m_window->close();
+
                 break;
             }
 
-            // Calculate delta
-            const double now     = timer.getElapsedTime().asMilliseconds();
-            const sf::Time delta = initial ? sf::Time::Zero : sf::milliseconds(static_cast<int>(now - last));
+            // Calculate delta, keep the full clock precision to avoid drifting at high refresh rates
+            const sf::Time now   = timer.getElapsedTime();
+            const sf::Time delta = initial ? sf::Time::Zero : m_frameTime > sf::Time::Zero ? m_frameTime : now - last;
             last = now;
 
             // Update fps counter
             frames++;
 
             // Track the number of frames rendered in a second
-            fpsDelta += delta.asMilliseconds();
-            if (fpsDelta >= 1000)
+            fpsDelta += delta;
+            if (fpsDelta >= sf::seconds(1))
             {
                 m_renderFreq = frames;
                 frames       = 0;
 
-                fpsDelta -= 1000.f;
+                fpsDelta -= sf::seconds(1);
             }
 
             // Perform update before rendering objects
-            Update(delta);
+            float alpha = 1.f;
+            if (m_fixedTimestep > sf::Time::Zero)
+            {
+                unsimulated += delta;
+                for (unsigned int steps = 0; unsimulated >= m_fixedTimestep && steps < m_maxUpdateSteps; steps++)
+                {
+                    Update(m_fixedTimestep);
+                    unsimulated -= m_fixedTimestep;
+                }
+
+                // Drop the backlog we could not catch up with instead of spiraling further behind
+                unsimulated = unsimulated % m_fixedTimestep;
+                alpha = unsimulated / m_fixedTimestep;
+            }
+            else
+                Update(delta);
 
             // Render the window
-            m_window->clear(m_clearColor);
+            Clear(m_clearColor);
             {
                 // Render objects
-                Render(*this, RenderStates(sf::RenderStates::Default, m_frameID++, delta));
+                Render(*this, RenderStates(sf::RenderStates::Default, m_frameID++, delta, alpha));
             }
-            m_window->display();
+
+            if (m_window)
+                m_window->display();
 
             // Execute post-processing events
             if (const auto director = FindModule<SceneDirector>())
@@ -156,14 +164,57 @@ namespace Gx
 
             // Mark initial frame has been processed
             initial = false;
+            processed++;
         }
 
         // Clean up with application exit code
         return Shutdown();
     }
 
+    void Application::ProcessEvent(const sf::Event& ev)
+    {
+        // Call window event handlers based on received event
+        if (ev.is<sf::Event::MouseMovedRaw>())
+            return;
+
+        if (ev.is<sf::Event::Closed>())
+        {
+            // Ask game permission first before closing
+            Close();
+        }
+        else if (ev.is<sf::Event::FocusGained>())
+        {
+            OnFocusChanged(true);
+            if (const auto director = FindModule<SceneDirector>())
+                director->Focus(true);
+        }
+        else if (ev.is<sf::Event::FocusLost>())
+        {
+            OnFocusChanged(false);
+            if (const auto director = FindModule<SceneDirector>())
+                director->Focus(false);
+        }
+        else if (const auto e = ev.getIf<sf::Event::Resized>())
+        {
+            OnResized(e->size);
+            if (const auto director = FindModule<SceneDirector>())
+                director->Resize(e->size);
+        }
+        else
+        {
+            if (ev.is<sf::Event::MouseButtonPressed>() || ev.is<sf::Event::MouseButtonReleased>())
+                UpdateCursor(ev);
+
+            auto input = ev;
+            OnInputReceived(input);
+        }
+    }
+
     sf::RenderWindow& Application::GetMainWindow() const
     {
+        if (!m_window)
+            throw InvalidOperationException("Headless application has no window");
+
         return *m_window;
     }
 
@@ -209,6 +260,72 @@ namespace Gx
         return m_renderFreq;
     }
 
+    const sf::Time& Application::GetFixedTimestep() const
+    {
+        return m_fixedTimestep;
+    }
+
+    unsigned int Application::GetMaxUpdateSteps() const
+    {
+        return m_maxUpdateSteps;
+    }
+
+    void Application::SetFixedTimestep(const sf::Time& step, const unsigned int maxSteps)
+    {
+        m_fixedTimestep  = std::max(step, sf::Time::Zero);
+        m_maxUpdateSteps = std::max(maxSteps, 1u);
+    }
+
+    bool Application::IsHeadless() const
+    {
+        return m_headless;
+    }
+
+    void Application::SetHeadless(const bool headless)
+    {
+        if (m_instance == this)
+            throw InvalidOperationException("Headless mode cannot be changed after the application is started");
+
+        m_headless = headless;
+    }
+
+    std::size_t Application::GetFrameLimit() const
+    {
+        return m_frameLimit;
+    }
+
+    void Application::SetFrameLimit(const std::size_t frames)
+    {
+        m_frameLimit = frames;
+    }
+
+    const sf::Time& Application::GetFrameTime() const
+    {
+        return m_frameTime;
+    }
+
+    void Application::SetFrameTime(const sf::Time& frameTime)
+    {
+        m_frameTime = std::max(frameTime, sf::Time::Zero);
+    }
+
+    void Application::PushEvent(const sf::Event& ev)
+    {
+        m_events.push(ev);
+    }
+
+    bool Application::IsVerticalSyncEnabled() const
+    {
+        return m_verticalSync;
+    }
+
+    void Application::SetVerticalSyncEnabled(const bool enabled)
+    {
+        m_verticalSync = enabled;
+        if (m_window)
+            m_window->setVerticalSyncEnabled(enabled);
+    }
+
     sf::State Application::GetWindowState() const
     {
         return m_state;
@@ -220,7 +337,8 @@ namespace Gx
             return;
 
         m_state = state;
-        CreateMainWindow();
+        if (!m_headless)
+            CreateMainWindow();
     }
 
     void Application::OnWindowCreated(sf::RenderWindow& window)
@@ -246,54 +364,57 @@ namespace Gx
 
     void Application::OnInputReceived(sf::Event& ev)
     {
-        // Re-map mouse coordinate
-        if (const auto mv = ev.getIf<sf::Event::MouseMoved>())
+        // Re-map mouse coordinate, synthetic events of headless application are already mapped
+        if (m_window)
         {
-            const auto position = m_window->mapPixelToCoords(mv->position);
-            ev = sf::Event::MouseMoved
+            if (const auto mv = ev.getIf<sf::Event::MouseMoved>())
             {
+                const auto position = m_window->mapPixelToCoords(mv->position);
+                ev = sf::Event::MouseMoved
                 {
-                    static_cast<int>(position.x),
-                    static_cast<int>(position.y)
-                }
-            };
-        }
-        else if (const auto mp = ev.getIf<sf::Event::MouseButtonPressed>())
-        {
-            const auto position = m_window->mapPixelToCoords(mp->position);
-            ev = sf::Event::MouseButtonPressed
+                    {
+                        static_cast<int>(position.x),
+                        static_cast<int>(position.y)
+                    }
+                };
+            }
+            else if (const auto mp = ev.getIf<sf::Event::MouseButtonPressed>())
             {
-                mp->button,
+                const auto position = m_window->mapPixelToCoords(mp->position);
+                ev = sf::Event::MouseButtonPressed
                 {
-                    static_cast<int>(position.x),
-                    static_cast<int>(position.y)
-                }
-            };
-        }
-        else if (const auto mr = ev.getIf<sf::Event::MouseButtonReleased>())
-        {
-            const auto position = m_window->mapPixelToCoords(mr->position);
-            ev = sf::Event::MouseButtonReleased
+                    mp->button,
+                    {
+                        static_cast<int>(position.x),
+                        static_cast<int>(position.y)
+                    }
+                };
+            }
+            else if (const auto mr = ev.getIf<sf::Event::MouseButtonReleased>())
             {
-                mr->button,
+                const auto position = m_window->mapPixelToCoords(mr->position);
+                ev = sf::Event::MouseButtonReleased
                 {
-                    static_cast<int>(position.x),
-                    static_cast<int>(position.y)
-                }
-            };
-        }
-        else if (const auto mw = ev.getIf<sf::Event::MouseWheelScrolled>())
-        {
-            const auto position = m_window->mapPixelToCoords(mw->position);
-            ev = sf::Event::MouseWheelScrolled
+                    mr->button,
+                    {
+                        static_cast<int>(position.x),
+                        static_cast<int>(position.y)
+                    }
+                };
+            }
+            else if (const auto mw = ev.getIf<sf::Event::MouseWheelScrolled>())
             {
-                mw->wheel,
-                mw->delta,
+                const auto position = m_window->mapPixelToCoords(mw->position);
+                ev = sf::Event::MouseWheelScrolled
                 {
-                    static_cast<int>(position.x),
-                    static_cast<int>(position.y)
-                }
-            };
+                    mw->wheel,
+                    mw->delta,
+                    {
+                        static_cast<int>(position.x),
+                        static_cast<int>(position.y)
+                    }
+                };
+            }
         }
 
         // Pass input into modules (e.g. the active scene via the scene director)
@@ -311,6 +432,9 @@ namespace Gx
 
     void Application::CreateMainWindow()
     {
+        if (m_headless)
+            return;
+
         // Close existing window
         if (m_window)
             m_window->close();
@@ -332,7 +456,7 @@ namespace Gx
         if (m_state == sf::State::Fullscreen)
             m_window->setPosition(sf::Vector2i(0, 0));
 
-        m_window->setVerticalSyncEnabled(true);
+        m_window->setVerticalSyncEnabled(m_verticalSync);
         m_window->setView(m_view);
 
         UpdateCursor(sf::Event::Closed());
@@ -341,7 +465,7 @@ namespace Gx
 
     void Application::UpdateCursor(const sf::Event& ev) const
     {
-        if (!m_cursor)
+        if (!m_cursor || !m_window)
             return;
 
         auto type = Cursor::Type::Arrow;
@@ -373,12 +497,14 @@ namespace Gx
     void Application::SetCursor(Cursor& cursor)
     {
         m_cursor = &cursor;
-        m_window->setMouseCursor(m_cursor->GetHandle());
+        if (m_window)
+            m_window->setMouseCursor(m_cursor->GetHandle());
     }
 
     void Application::InvalidateCursor() const
     {
-        m_window->setMouseCursor(m_cursor->GetHandle());
+        if (m_window)
+            m_window->setMouseCursor(m_cursor->GetHandle());
     }
 
     sf::VideoMode Application::GetCurrentVideoMode() const
@@ -393,22 +519,27 @@ namespace Gx
 
     const sf::View& Application::GetView() const
     {
-        return m_window->getView();
+        return m_window ? m_window->getView() : m_headlessView;
     }
 
     void Application::SetView(const sf::View& view)
     {
-        m_window->setView(view);
+        if (m_window)
+            m_window->setView(view);
+        else
+            m_headlessView = view;
     }
 
     void Application::Clear(const sf::Color clearColor)
     {
-        m_window->clear(clearColor);
+        if (m_window)
+            m_window->clear(clearColor);
     }
 
     void Application::Clear(const sf::Color clearColor, const sf::StencilValue stencilValue)
     {
-        m_window->clear(clearColor, stencilValue);
+        if (m_window)
+            m_window->clear(clearColor, stencilValue);
     }
 
     void Application::Render(const Renderable& renderable, const RenderStates& states)
@@ -418,27 +549,30 @@ namespace Gx
 
     void Application::Render(const sf::Vertex* vertices, const std::size_t vertexCount, const sf::PrimitiveType type, const RenderStates& states)
     {
-        m_window->draw(vertices, vertexCount, type, states);
+        if (m_window)
+            m_window->draw(vertices, vertexCount, type, states);
     }
 
     void Application::Render(const sf::VertexBuffer& vertexBuffer, const RenderStates& states)
     {
-        m_window->draw(vertexBuffer, states);
+        if (m_window)
+            m_window->draw(vertexBuffer, states);
     }
 
     void Application::Render(const sf::VertexBuffer& vertexBuffer, const std::size_t firstVertex, const std::size_t vertexCount, const RenderStates& states)
     {
-        m_window->draw(vertexBuffer, firstVertex, vertexCount, states);
+        if (m_window)
+            m_window->draw(vertexBuffer, firstVertex, vertexCount, states);
     }
 
     Application::operator sf::RenderTarget&() const
     {
-        return *m_window;
+        return GetMainWindow();
     }
 
     Application::operator sf::RenderWindow&() const
     {
-        return *m_window;
+        return GetMainWindow();
     }
 
     sf::VideoMode Application::GetDesktopVideoMode()
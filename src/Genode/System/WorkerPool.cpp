@@ -0,0 +1,128 @@
+#include <Genode/System/WorkerPool.hpp>
+
+namespace Gx
+{
+    namespace
+    {
+        // Set on worker threads and on a thread that is currently running jobs
+        thread_local bool t_executing = false;
+    }
+
+    WorkerPool::WorkerPool(const std::size_t workers)
+    {
+        m_threads.reserve(workers);
+        for (std::size_t i = 0; i < workers; i++)
+            m_threads.emplace_back(&WorkerPool::Work, this);
+    }
+
+    WorkerPool::~WorkerPool()
+    {
+        {
+            auto lock = std::lock_guard(m_mutex);
+            m_stopping = true;
+        }
+
+        m_wake.notify_all();
+        for (auto& thread : m_threads)
+            thread.join();
+    }
+
+    WorkerPool& WorkerPool::GetShared()
+    {
+        const auto concurrency = std::thread::hardware_concurrency();
+        static WorkerPool pool(concurrency > 1 ? concurrency - 1 : 0);
+
+        return pool;
+    }
+
+    std::size_t WorkerPool::GetWorkerCount() const
+    {
+        return m_threads.size();
+    }
+
+    void WorkerPool::Run(const std::size_t count, const std::function<void(std::size_t)>& job)
+    {
+        if (count == 0 || !job)
+            return;
+
+        if (t_executing || m_threads.empty() || count == 1)
+        {
+            for (std::size_t i = 0; i < count; i++)
+                job(i);
+
+            return;
+        }
+
+        auto runLock = std::lock_guard(m_runMutex);
+        {
+            auto lock = std::lock_guard(m_mutex);
+            m_job    = &job;
+            m_count  = count;
+            m_active = m_threads.size();
+            m_error  = nullptr;
+            m_next.store(0);
+            m_generation++;
+        }
+
+        m_wake.notify_all();
+
+        t_executing = true;
+        Execute();
+        t_executing = false;
+
+        auto error = std::exception_ptr();
+        {
+            auto lock = std::unique_lock(m_mutex);
+            m_done.wait(lock, [this] { return m_active == 0; });
+
+            m_job = nullptr;
+            std::swap(error, m_error);
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void WorkerPool::Work()
+    {
+        t_executing = true;
+
+        std::uint64_t generation = 0;
+        while (true)
+        {
+            {
+                auto lock = std::unique_lock(m_mutex);
+                m_wake.wait(lock, [this, generation] { return m_stopping || m_generation != generation; });
+                if (m_stopping)
+                    return;
+
+                generation = m_generation;
+            }
+
+            Execute();
+
+            {
+                auto lock = std::lock_guard(m_mutex);
+                if (--m_active == 0)
+                    m_done.notify_one();
+            }
+        }
+    }
+
+    void WorkerPool::Execute()
+    {
+        for (auto index = m_next.fetch_add(1); index < m_count; index = m_next.fetch_add(1))
+        {
+            try
+            {
+                (*m_job)(index);
+            }
+            catch (...)
+            {
+                auto lock = std::lock_guard(m_mutex);
+                if (!m_error)
+                    m_error = std::current_exception();
+            }
+        }
+    }
+}
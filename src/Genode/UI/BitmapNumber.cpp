@@ -260,6 +260,8 @@ namespace Gx
 
     void BitmapNumber::Invalidate()
     {
+        InvalidateHitArea();
+
         const auto color = GetColor();
         m_vertices = sf::VertexArray(sf::PrimitiveType::Triangles, 6 * 10);
         m_width    = 0;
@@ -18,6 +18,8 @@ namespace Gx
     {
         for (auto& vertex : m_vertices)
             vertex.color = color;
+
+        InvalidateRenderVersion();
     }
 
     const sf::Texture* Button::GetTexture() const
@@ -119,7 +121,7 @@ namespace Gx
         if (m_texture && currentTexCoords.size.x > 0 && currentTexCoords.size.y > 0)
         {
             states.texture = m_texture;
-            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, states);
+            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, GetRenderVersion(), states);
         }
 
         return RenderableContainer::Render(surface, states);
@@ -132,6 +134,8 @@ namespace Gx
         m_vertices[1].position = sf::Vector2f(0, bounds.size.y);
         m_vertices[2].position = sf::Vector2f(bounds.size.x, 0);
         m_vertices[3].position = sf::Vector2f(bounds.size.x, bounds.size.y);
+
+        InvalidateRenderVersion();
     }
 
     void Button::UpdateTexCoords()
@@ -146,10 +150,14 @@ namespace Gx
         m_vertices[1].texCoords = sf::Vector2f(left, bottom);
         m_vertices[2].texCoords = sf::Vector2f(right, top);
         m_vertices[3].texCoords = sf::Vector2f(right, bottom);
+
+        InvalidateRenderVersion();
     }
 
     void Button::Invalidate()
     {
+        InvalidateHitArea();
+
         if (!IsEnabled())
             return;
 
@@ -3,6 +3,12 @@
 
 namespace Gx
 {
+    namespace
+    {
+        // Set while a control changes its state, the invalidations it causes do not move any hit area
+        thread_local bool changingState = false;
+    }
+
     Control::Control() :
         m_state(State::Normal),
         m_enabled(true),
@@ -76,24 +82,47 @@ namespace Gx
         if (m_state != state)
         {
             m_state = state;
+            const auto changing = changingState;
+            changingState = true;
+
             SetFocus(m_state == State::Hover || m_state == State::Active);
             if (IsEnabled())
                 OnControlStateChanged(*this, m_state);
+
+            changingState = changing;
         }
     }
 
-    sf::FloatRect Control::GetGlobalBounds() const
+    bool Control::IsPointerEngaged() const
     {
-        auto parent    = GetParent();
-        auto transform = sf::Transform::Identity;
-        while (parent)
+        if (m_state != State::Normal)
+            return true;
+
+        for (const auto child : GetChildren())
         {
-            transform *= parent->GetTransform();
-            parent = parent->GetParent();
+            if (const auto control = child->AsControl(); control && control->IsPointerEngaged())
+                return true;
         }
 
-        transform *= GetTransform();
-        return transform.transformRect(GetLocalBounds());
+        return false;
+    }
+
+    void Control::InvalidateHitArea() const
+    {
+        if (changingState)
+            return;
+
+        for (auto parent = GetParentControl(); parent; parent = parent->GetParentControl())
+            parent->OnHitAreaChanged();
+    }
+
+    void Control::OnHitAreaChanged()
+    {
+    }
+
+    sf::FloatRect Control::GetGlobalBounds() const
+    {
+        return GetWorldTransform().transformRect(GetLocalBounds());
     }
 
     void Control::SetFocusChangedCallback(std::function<void(Control&, Event&)> callback)
@@ -317,7 +346,7 @@ namespace Gx
 
     void Control::OnChildAdded(Node& node)
     {
-        if (const auto control = dynamic_cast<Control*>(&node); control)
+        if (const auto control = node.AsControl())
         {
             OnControlChildAdded(*control);
             // Invalidate();
@@ -326,13 +355,26 @@ namespace Gx
 
     void Control::OnChildRemove(Node& node)
     {
-        if (const auto control = dynamic_cast<Control*>(&node); control)
+        if (const auto control = node.AsControl())
         {
             OnControlChildRemove(*control);
             // Invalidate();
         }
     }
 
+    void Control::OnTransformChanged()
+    {
+        Node::OnTransformChanged();
+        for (auto parent = GetParentControl(); parent; parent = parent->GetParentControl())
+            parent->OnHitAreaChanged();
+    }
+
+    Control* Control::GetParentControl() const
+    {
+        const auto parent = GetParent();
+        return parent ? parent->AsControl() : nullptr;
+    }
+
     void Control::OnControlChildAdded(Control& control)
     {
     }
@@ -345,25 +387,25 @@ namespace Gx
     {
         Invalidate();
 
-        if (const auto parent = dynamic_cast<Control*>(GetParent()))
+        if (const auto parent = GetParentControl())
             parent->OnControlStateChanged(sender, state);
     }
 
     void Control::OnControlPress(Control& sender, const sf::Event::MouseButtonPressed& ev)
     {
-        if (const auto parent = dynamic_cast<Control*>(GetParent()))
+        if (const auto parent = GetParentControl())
             parent->OnControlPress(sender, ev);
     }
 
     void Control::OnControlClick(Control& sender, const sf::Event::MouseButtonReleased& ev)
     {
-        if (const auto parent = dynamic_cast<Control*>(GetParent()))
+        if (const auto parent = GetParentControl())
             parent->OnControlClick(sender, ev);
     }
 
     void Control::OnControlDoubleClick(Control& sender, const sf::Event::MouseButtonPressed& ev)
     {
-        if (const auto parent = dynamic_cast<Control*>(GetParent()))
+        if (const auto parent = GetParentControl())
             parent->OnControlDoubleClick(sender, ev);
     }
 
@@ -214,6 +214,8 @@ namespace Gx
 
     void Gauge::Invalidate()
     {
+        InvalidateHitArea();
+
         if (m_currentFrame < m_frames.size())
         {
             const auto& frame = m_frames[m_currentFrame];
@@ -52,6 +52,22 @@ namespace Gx
         SetTexCoords(rectangle);
     }
 
+    Image::Image(const TextureRegion& region):
+        m_vertices(),
+        m_texture(nullptr),
+        m_texcoords(),
+        m_bounds(),
+        m_sizeMode(SizeMode::Normal),
+        m_blendMode(BlendMode::Auto),
+        m_frameName(),
+        m_frameIndex(0),
+        m_currentFrame(nullptr),
+        m_indices(),
+        m_frames()
+    {
+        SetTexture(region);
+    }
+
     sf::FloatRect Image::GetLocalBounds() const
     {
         if (m_bounds != sf::FloatRect())
@@ -68,6 +84,17 @@ namespace Gx
         return Control::GetGlobalBounds();
     }
 
+    std::optional<sf::FloatRect> Image::GetRenderBounds() const
+    {
+        if (GetChildrenCount() > 0)
+            return std::nullopt;
+
+        // Vertices may extend past the local bounds depending on the size mode
+        const auto& topLeft     = m_vertices[0].position;
+        const auto& bottomRight = m_vertices[3].position;
+        return GetTransform().transformRect(sf::FloatRect(topLeft, bottomRight - topLeft));
+    }
+
     const sf::Texture* Image::GetTexture() const
     {
         return m_texture;
@@ -101,6 +128,12 @@ namespace Gx
         m_texture = &texture;
     }
 
+    void Image::SetTexture(const TextureRegion& region)
+    {
+        m_texture = region.Texture;
+        SetTexCoords(region.TexCoords);
+    }
+
     void Image::SetTexCoords(const sf::IntRect& rectangle)
     {
         if (rectangle != m_texcoords)
@@ -123,6 +156,8 @@ namespace Gx
     {
         for (auto& vertex : m_vertices)
             vertex.color = color;
+
+        InvalidateRenderVersion();
     }
 
     void Image::SetSizeMode(const SizeMode sizeMode)
@@ -271,7 +306,7 @@ namespace Gx
         if (m_texture)
         {
             states.texture = m_texture;
-            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, states);
+            surface.Render(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TriangleStrip, GetRenderVersion(), states);
         }
 
         return RenderableContainer::Render(surface, states);
@@ -327,9 +362,12 @@ namespace Gx
         m_vertices[1].texCoords = position + sf::Vector2f(0.f, size.y);
         m_vertices[2].texCoords = position + sf::Vector2f(size.x, 0.f);
         m_vertices[3].texCoords = position + size;
+
+        InvalidateRenderVersion();
     }
 
     void Image::Invalidate()
     {
+        InvalidateHitArea();
     }
 }
\ No newline at end of file
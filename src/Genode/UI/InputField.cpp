@@ -773,6 +773,8 @@ namespace Gx
 
     void InputField::Invalidate()
     {
+        InvalidateHitArea();
+
         m_caret.Invalidate();
         m_caret.Reset(true);
 
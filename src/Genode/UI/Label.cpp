@@ -95,6 +95,7 @@ namespace Gx
 
     void Label::Invalidate()
     {
+        InvalidateHitArea();
         EnsureGeometryUpdate();
 
         if (m_bounds != sf::FloatRect{})
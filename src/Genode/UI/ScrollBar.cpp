@@ -169,15 +169,7 @@ namespace Gx
 
     sf::FloatRect ScrollBar::GetScrollBarGlobalBounds() const
     {
-        auto parent    = GetParent();
-        auto transform = sf::Transform::Identity;
-        while (parent)
-        {
-            transform *= parent->GetTransform();
-            parent = parent->GetParent();
-        }
-
-        transform *= GetTransform();
+        auto transform = GetWorldTransform();
         transform *= m_sprite.GetTransform();
 
         return transform.transformRect(m_sprite.GetLocalBounds());
@@ -317,6 +309,8 @@ namespace Gx
 
     void ScrollBar::Invalidate()
     {
+        InvalidateHitArea();
+
         auto position = m_sprite.GetPosition();
         if (m_maxValue <= 0.f)
             return;
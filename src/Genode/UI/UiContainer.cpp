@@ -2,6 +2,9 @@
 #include <Genode/UI/RadioButton.hpp>
 #include <Genode/UI/InputField.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 namespace Gx
 {
     UiContainer::UiContainer() :
@@ -46,6 +49,17 @@ namespace Gx
         m_useBatching = batchingEnabled;
     }
 
+    bool UiContainer::IsHitTestIndexed() const
+    {
+        return m_hitTestIndexed;
+    }
+
+    void UiContainer::SetHitTestIndexed(const bool indexed)
+    {
+        m_hitTestIndexed = indexed;
+        m_hitGridDirty   = true;
+    }
+
     void UiContainer::Apply(const std::function<void(Control&)>& fun) const
     {
         if (!fun)
@@ -53,7 +67,7 @@ namespace Gx
 
         for (const auto child : GetChildren())
         {
-            if (const auto control = dynamic_cast<Control*>(child))
+            if (const auto control = child->AsControl())
                 fun(*control);
         }
     }
@@ -125,8 +139,228 @@ namespace Gx
             Control::Update(delta);
     }
 
+    bool UiContainer::Input(const sf::Event& ev)
+    {
+        // Only mouse movement is routed, clicks and scrolls are still broadcast since controls such as
+        // InputField react to them outside of their own bounds
+        const auto mouseMove = ev.getIf<sf::Event::MouseMoved>();
+        if (!m_hitTestIndexed || !mouseMove || !IsEnabled())
+        {
+            const bool handled = Control::Input(ev);
+
+            // Broadcast events may change the pointer engagement of any child, which does not move the hit area.
+            // Changes of the hit area itself are signaled through OnHitAreaChanged and the container version.
+            if (m_hitTestIndexed)
+                UpdateHitEngagement();
+
+            return handled;
+        }
+
+        if (!Inputable::Input(ev))
+            return false;
+
+        RouteInput(ev, sf::Vector2f(mouseMove->position.x, mouseMove->position.y));
+        return true;
+    }
+
+    bool UiContainer::IsPointerEngaged() const
+    {
+        if (!m_hitTestIndexed)
+            return Control::IsPointerEngaged();
+
+        return GetControlState() != State::Normal || !m_hitEngaged.empty();
+    }
+
+    void UiContainer::OnHitAreaChanged()
+    {
+        m_hitGridDirty = true;
+    }
+
+    void UiContainer::OnWorldTransformInvalidated()
+    {
+        m_hitGridDirty = true;
+    }
+
+    sf::FloatRect UiContainer::GetHitBounds(const Control& control)
+    {
+        // Descendants are not guaranteed to lie within the bounds of their parent, so the hit area of a control
+        // covers its whole subtree
+        auto bounds = control.GetGlobalBounds();
+        for (const auto child : control.GetChildren())
+        {
+            const auto descendant = child->AsControl();
+            if (!descendant)
+                continue;
+
+            const auto area = GetHitBounds(*descendant);
+            if (area.size.x <= 0.f || area.size.y <= 0.f)
+                continue;
+
+            if (bounds.size.x <= 0.f || bounds.size.y <= 0.f)
+            {
+                bounds = area;
+                continue;
+            }
+
+            const auto min = sf::Vector2f(std::min(bounds.position.x, area.position.x), std::min(bounds.position.y, area.position.y));
+            const auto max = sf::Vector2f(
+                std::max(bounds.position.x + bounds.size.x, area.position.x + area.size.x),
+                std::max(bounds.position.y + bounds.size.y, area.position.y + area.size.y)
+            );
+
+            bounds = sf::FloatRect(min, max - min);
+        }
+
+        return bounds;
+    }
+
+    void UiContainer::BuildHitGrid()
+    {
+        m_hitEntries.clear();
+        m_hitAlways.clear();
+        m_hitEngaged.clear();
+
+        auto area  = sf::FloatRect();
+        bool first = true;
+
+        for (const auto child : GetChildren())
+        {
+            const auto inputable = child->AsInputable();
+            if (!inputable)
+                continue;
+
+            auto entry = HitEntry{inputable, child->AsControl(), {}};
+            if (entry.AsControl)
+            {
+                entry.Bounds = GetHitBounds(*entry.AsControl);
+                if (entry.AsControl->IsPointerEngaged())
+                    m_hitEngaged.push_back(m_hitEntries.size());
+
+                if (first)
+                {
+                    area  = entry.Bounds;
+                    first = false;
+                }
+
+                const auto min = sf::Vector2f(std::min(area.position.x, entry.Bounds.position.x), std::min(area.position.y, entry.Bounds.position.y));
+                const auto max = sf::Vector2f(
+                    std::max(area.position.x + area.size.x, entry.Bounds.position.x + entry.Bounds.size.x),
+                    std::max(area.position.y + area.size.y, entry.Bounds.position.y + entry.Bounds.size.y)
+                );
+
+                area = sf::FloatRect(min, max - min);
+            }
+            else
+            {
+                // Inputables without bounds can not be hit-tested, they receive every event
+                m_hitAlways.push_back(m_hitEntries.size());
+            }
+
+            m_hitEntries.push_back(entry);
+        }
+
+        // Roughly one control per cell, capped so sparse or huge containers do not allocate excessive cells
+        const auto controls = m_hitEntries.size() - m_hitAlways.size();
+        const auto cells    = std::clamp<std::size_t>(static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(controls)))), 1, HIT_GRID_MAX_CELLS);
+
+        m_hitGridArea = area;
+        m_hitGridSize = {cells, cells};
+        m_hitCellSize = {
+            area.size.x > 0.f ? area.size.x / static_cast<float>(cells) : 1.f,
+            area.size.y > 0.f ? area.size.y / static_cast<float>(cells) : 1.f
+        };
+
+        m_hitCells.resize(cells * cells);
+        for (auto& cell : m_hitCells)
+            cell.clear();
+
+        const auto toCell = [this] (const float value, const float origin, const float size, const std::size_t count)
+        {
+            const auto index = std::floor((value - origin) / size);
+            return static_cast<std::size_t>(std::clamp(index, 0.f, static_cast<float>(count - 1)));
+        };
+
+        for (std::size_t i = 0; i < m_hitEntries.size(); i++)
+        {
+            const auto& entry = m_hitEntries[i];
+            if (!entry.AsControl)
+                continue;
+
+            const auto& bounds = entry.Bounds;
+            const auto x0 = toCell(bounds.position.x, area.position.x, m_hitCellSize.x, cells);
+            const auto y0 = toCell(bounds.position.y, area.position.y, m_hitCellSize.y, cells);
+            const auto x1 = toCell(bounds.position.x + bounds.size.x, area.position.x, m_hitCellSize.x, cells);
+            const auto y1 = toCell(bounds.position.y + bounds.size.y, area.position.y, m_hitCellSize.y, cells);
+
+            for (auto y = y0; y <= y1; y++)
+            {
+                for (auto x = x0; x <= x1; x++)
+                    m_hitCells[y * cells + x].push_back(i);
+            }
+        }
+
+        m_hitGridVersion = GetVersion();
+        m_hitGridDirty   = false;
+    }
+
+    void UiContainer::UpdateHitEngagement()
+    {
+        // Entries of an outdated grid may refer to removed children, they are collected again on the next route
+        if (m_hitGridDirty || m_hitGridVersion != GetVersion())
+            return;
+
+        m_hitEngaged.clear();
+        for (std::size_t i = 0; i < m_hitEntries.size(); i++)
+        {
+            const auto control = m_hitEntries[i].AsControl;
+            if (control && control->IsPointerEngaged())
+                m_hitEngaged.push_back(i);
+        }
+    }
+
+    void UiContainer::RouteInput(const sf::Event& ev, const sf::Vector2f& position)
+    {
+        // Keep children attached while routing, mutations requested by handlers are applied afterward
+        const auto children = GetChildren();
+        if (m_hitGridDirty || m_hitGridVersion != GetVersion())
+            BuildHitGrid();
+
+        // Candidates are controls under the pointer, controls that are still engaged (e.g. hovered by the previous
+        // event) and inputables without bounds
+        m_hitRouted.clear();
+        m_hitRouted.insert(m_hitRouted.end(), m_hitAlways.begin(), m_hitAlways.end());
+        m_hitRouted.insert(m_hitRouted.end(), m_hitEngaged.begin(), m_hitEngaged.end());
+
+        if (m_hitGridArea.contains(position))
+        {
+            const auto x = std::min(static_cast<std::size_t>((position.x - m_hitGridArea.position.x) / m_hitCellSize.x), m_hitGridSize.x - 1);
+            const auto y = std::min(static_cast<std::size_t>((position.y - m_hitGridArea.position.y) / m_hitCellSize.y), m_hitGridSize.y - 1);
+
+            for (const auto index : m_hitCells[y * m_hitGridSize.x + x])
+            {
+                if (m_hitEntries[index].Bounds.contains(position))
+                    m_hitRouted.push_back(index);
+            }
+        }
+
+        // Dispatch in child order, the same order a broadcast would use
+        std::sort(m_hitRouted.begin(), m_hitRouted.end());
+        m_hitRouted.erase(std::unique(m_hitRouted.begin(), m_hitRouted.end()), m_hitRouted.end());
+
+        m_hitEngaged.clear();
+        for (const auto index : m_hitRouted)
+        {
+            const auto& entry = m_hitEntries[index];
+            entry.Instance->Input(ev);
+
+            if (entry.AsControl && entry.AsControl->IsPointerEngaged())
+                m_hitEngaged.push_back(index);
+        }
+    }
+
     void UiContainer::Invalidate()
     {
+        InvalidateHitArea();
         if (m_localBounds != sf::FloatRect())
             return;
 
@@ -135,7 +369,7 @@ namespace Gx
 
         for (const auto node : GetChildren())
         {
-            const auto control = dynamic_cast<Control*>(node);
+            const auto control = node->AsControl();
             if (!control)
                 continue;
 